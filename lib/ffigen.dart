@@ -7,6 +7,6 @@
 /// See complete usage at - https://pub.dev/packages/ffigen.
 library ffigen;
 
-export 'src/code_generator.dart' show Library;
+export 'src/code_generator.dart' show DependencyGraph, Library;
 export 'src/config_provider.dart' show Config;
-export 'src/header_parser.dart' show parse;
+export 'src/header_parser.dart' show parse, parseIr;
@@ -5,10 +5,13 @@
 /// Generates FFI bindings for a given [Library].
 library code_generator;
 
+export 'code_generator/batch_wrapper.dart';
 export 'code_generator/binding.dart';
 export 'code_generator/compound.dart';
 export 'code_generator/constant.dart';
+export 'code_generator/dependency_graph.dart';
 export 'code_generator/enum_class.dart';
+export 'code_generator/finalizable_handle.dart';
 export 'code_generator/func.dart';
 export 'code_generator/func_type.dart';
 export 'code_generator/global.dart';
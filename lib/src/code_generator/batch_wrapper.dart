@@ -0,0 +1,147 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:ffigen/src/code_generator.dart';
+
+import '../strings.dart' as strings;
+import 'utils.dart';
+
+/// Element type of an array passed to a batch shim.
+///
+/// ABI specific integers, such as `long`, are passed as 64 bit integers, so
+/// that the arrays have the same layout on all platforms.
+class BatchElementType {
+  final SupportedNativeType nativeType;
+
+  /// Spelling of the type in C, such as `int64_t`.
+  final String cType;
+
+  /// Name of the matching class in `dart:typed_data`, such as `Int64List`.
+  final String typedDataClass;
+
+  const BatchElementType(this.nativeType, this.cType, this.typedDataClass);
+}
+
+const _int8 = BatchElementType(SupportedNativeType.Int8, 'int8_t', 'Int8List');
+const _uint8 =
+    BatchElementType(SupportedNativeType.Uint8, 'uint8_t', 'Uint8List');
+const _int16 =
+    BatchElementType(SupportedNativeType.Int16, 'int16_t', 'Int16List');
+const _uint16 =
+    BatchElementType(SupportedNativeType.Uint16, 'uint16_t', 'Uint16List');
+const _int32 =
+    BatchElementType(SupportedNativeType.Int32, 'int32_t', 'Int32List');
+const _uint32 =
+    BatchElementType(SupportedNativeType.Uint32, 'uint32_t', 'Uint32List');
+const _int64 =
+    BatchElementType(SupportedNativeType.Int64, 'int64_t', 'Int64List');
+const _uint64 =
+    BatchElementType(SupportedNativeType.Uint64, 'uint64_t', 'Uint64List');
+const _float =
+    BatchElementType(SupportedNativeType.Float, 'float', 'Float32List');
+const _double =
+    BatchElementType(SupportedNativeType.Double, 'double', 'Float64List');
+
+/// Scalar types which can be batched, keyed by their `dart:ffi` name, with
+/// their spelling in C and the element type of their arrays.
+const _scalarTypes = <String, (String, BatchElementType)>{
+  'Int8': ('int8_t', _int8),
+  'Uint8': ('uint8_t', _uint8),
+  'Int16': ('int16_t', _int16),
+  'Uint16': ('uint16_t', _uint16),
+  'Int32': ('int32_t', _int32),
+  'Uint32': ('uint32_t', _uint32),
+  'Int64': ('int64_t', _int64),
+  'Uint64': ('uint64_t', _uint64),
+  'IntPtr': ('intptr_t', _int64),
+  'UintPtr': ('uintptr_t', _uint64),
+  'Float': ('float', _float),
+  'Double': ('double', _double),
+  'Char': ('char', _int16),
+  'SignedChar': ('signed char', _int8),
+  'UnsignedChar': ('unsigned char', _uint8),
+  'Short': ('short', _int16),
+  'UnsignedShort': ('unsigned short', _uint16),
+  'Int': ('int', _int32),
+  'UnsignedInt': ('unsigned int', _uint32),
+  'Long': ('long', _int64),
+  'UnsignedLong': ('unsigned long', _uint64),
+  'LongLong': ('long long', _int64),
+  'UnsignedLongLong': ('unsigned long long', _uint64),
+  'Size': ('size_t', _uint64),
+  'WChar': ('wchar_t', _int64),
+};
+
+(String, BatchElementType)? _scalarType(Type type) {
+  final t = type.typealiasType;
+  if (t is BooleanType) return null;
+  if (t is NativeType) return _scalarTypes[t.toString()];
+  if (t is ImportedType && t.libraryImport == ffiImport) {
+    return _scalarTypes[t.cType];
+  }
+  return null;
+}
+
+bool _isVoid(Type type) {
+  final t = type.typealiasType;
+  return t == voidType || t == NativeType(SupportedNativeType.Void);
+}
+
+/// The element type of the arrays holding values of [type], or null if
+/// [type] can't be batched.
+BatchElementType? batchElementType(Type type) => _scalarType(type)?.$2;
+
+/// True if calls of a function with type [f] can be batched.
+///
+/// The function has to take at least one number and return a number or void.
+bool canBatch(FunctionType f) =>
+    f.parameters.isNotEmpty &&
+    f.varArgParameters.isEmpty &&
+    f.parameters.every((p) => _scalarType(p.type) != null) &&
+    (_isVoid(f.returnType) || _scalarType(f.returnType) != null);
+
+/// Name of the C function which calls [originalName] in a loop.
+String batchShimName(String originalName) =>
+    '${strings.batchShimPrefix}$originalName';
+
+/// True if [f] returns void, so its batch shim has no result array.
+bool batchReturnsVoid(Func f) => _isVoid(f.functionType.returnType);
+
+/// Writes a prototype of [f] and its batch shim in C.
+///
+/// The prototype only uses standard types, so that the generated source
+/// doesn't need to include the headers declaring [f].
+String batchShimCSource(Func f) {
+  final type = f.functionType;
+  final params = type.parameters;
+  final returnsVoid = batchReturnsVoid(f);
+  final namer = UniqueNamer(params.map((p) => p.name).toSet());
+  final resultName = namer.makeUnique('result');
+  final countName = namer.makeUnique('count');
+  final indexName = namer.makeUnique('i');
+
+  final returnCType = returnsVoid ? 'void' : _scalarType(type.returnType)!.$1;
+  final prototypeParams = [
+    for (final p in params) '${_scalarType(p.type)!.$1} ${p.name}'
+  ].join(', ');
+  final shimParams = [
+    for (final p in params)
+      'const ${batchElementType(p.type)!.cType} *${p.name}',
+    if (!returnsVoid)
+      '${batchElementType(type.returnType)!.cType} *$resultName',
+    'size_t $countName',
+  ].join(', ');
+  final call = '${f.originalName}('
+      '${params.map((p) => '${p.name}[$indexName]').join(', ')})';
+
+  return '''
+$returnCType ${f.originalName}($prototypeParams);
+
+void ${batchShimName(f.originalName)}($shimParams) {
+  for (size_t $indexName = 0; $indexName < $countName; $indexName++) {
+    ${returnsVoid ? '' : '$resultName[$indexName] = '}$call;
+  }
+}
+''';
+}
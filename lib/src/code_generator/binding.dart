@@ -32,6 +32,13 @@ abstract class Binding {
   /// Get all dependencies, including itself and save them in [dependencies].
   void addDependencies(Set<Binding> dependencies);
 
+  /// Resolves the names generated for this binding which are read by other
+  /// bindings or by the [Writer], such as the Dart aliases of a typedef.
+  ///
+  /// Called on all bindings, in order, before any of them is converted by
+  /// [toBindingString], whenever the [Writer] generates the bindings.
+  void resolveRenderNames(Writer w) {}
+
   /// Converts a Binding to its actual string representation.
   ///
   /// Note: This does not print the typedef dependencies.
@@ -25,4 +25,5 @@ enum BindingStringType {
   typeDef,
   objcInterface,
   objcBlock,
+  finalizableHandle,
 }
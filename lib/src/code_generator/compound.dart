@@ -30,6 +30,29 @@ abstract class Compound extends BindingType {
   /// Marker for checking if the dependencies are parsed.
   bool parsedDependencies = false;
 
+  /// Size in bytes, as computed by clang. Null if unknown.
+  int? size;
+
+  /// Alignment in bytes, as computed by clang. Null if unknown.
+  int? alignment;
+
+  /// If true, [size], [alignment] and the member offsets are written as
+  /// constants on the generated class.
+  bool generateLayoutTable;
+
+  /// If true, an extension on `Pointer<T>` is generated which reads and writes
+  /// primitive members at their clang computed offsets, without going through
+  /// `ref`.
+  bool generateOffsetAccessors;
+
+  /// Names of the generated layout constants, set by [resolveRenderNames].
+  String? _sizeOfName;
+  String? _alignOfName;
+  String? _offsetOfName;
+
+  /// Names of the members, set by [resolveRenderNames].
+  final _memberNames = ResolvedNames<Member>();
+
   CompoundType compoundType;
   bool get isStruct => compoundType == CompoundType.struct;
   bool get isUnion => compoundType == CompoundType.union;
@@ -44,6 +67,10 @@ abstract class Compound extends BindingType {
     super.dartDoc,
     List<Member>? members,
     super.isInternal,
+    this.size,
+    this.alignment,
+    this.generateLayoutTable = false,
+    this.generateOffsetAccessors = false,
   }) : members = members ?? [];
 
   factory Compound.fromType({
@@ -55,6 +82,8 @@ abstract class Compound extends BindingType {
     int? pack,
     String? dartDoc,
     List<Member>? members,
+    bool generateLayoutTable = false,
+    bool generateOffsetAccessors = false,
   }) {
     switch (type) {
       case CompoundType.struct:
@@ -66,6 +95,8 @@ abstract class Compound extends BindingType {
           pack: pack,
           dartDoc: dartDoc,
           members: members,
+          generateLayoutTable: generateLayoutTable,
+          generateOffsetAccessors: generateOffsetAccessors,
         );
       case CompoundType.union:
         return Union(
@@ -76,10 +107,19 @@ abstract class Compound extends BindingType {
           pack: pack,
           dartDoc: dartDoc,
           members: members,
+          generateLayoutTable: generateLayoutTable,
+          generateOffsetAccessors: generateOffsetAccessors,
         );
     }
   }
 
+  /// Whether the clang computed layout is known and should be written.
+  bool get hasLayoutTable => generateLayoutTable && !isOpaque && size != null;
+
+  /// Name of the generated size constant, only valid after the names of the
+  /// binding have been resolved and if [hasLayoutTable] is true.
+  String get sizeOfName => _sizeOfName!;
+
   List<int> _getArrayDimensionLengths(Type type) {
     final array = <int>[];
     var startType = type;
@@ -99,22 +139,37 @@ abstract class Compound extends BindingType {
   }
 
   @override
-  BindingString toBindingString(Writer w) {
-    final s = StringBuffer();
-    final enclosingClassName = name;
-    if (dartDoc != null) {
-      s.write(makeDartDoc(dartDoc!));
-    }
-
-    /// Adding [enclosingClassName] because dart doesn't allow class member
-    /// to have the same name as the class.
-    final localUniqueNamer = UniqueNamer({enclosingClassName});
+  void resolveRenderNames(Writer w) {
+    /// Adding [name] because dart doesn't allow class member to have the same
+    /// name as the class.
+    final localUniqueNamer = UniqueNamer({name});
 
     /// Marking type names because dart doesn't allow class member to have the
     /// same name as a type name used internally.
     for (final m in members) {
       localUniqueNamer.markUsed(m.type.getFfiDartType(w));
     }
+    for (final m in members) {
+      final declared = _memberNames.declared(m, m.name);
+      m.name = localUniqueNamer.makeUnique(declared);
+      _memberNames.save(m, declared, m.name);
+    }
+
+    // The size constant is read by the layout verifier of the [Writer].
+    if (hasLayoutTable) {
+      _sizeOfName = localUniqueNamer.makeUnique('sizeOf');
+      _alignOfName = localUniqueNamer.makeUnique('alignOf');
+      _offsetOfName = localUniqueNamer.makeUnique('offsetOf');
+    }
+  }
+
+  @override
+  BindingString toBindingString(Writer w) {
+    final s = StringBuffer();
+    final enclosingClassName = name;
+    if (dartDoc != null) {
+      s.write(makeDartDoc(dartDoc!));
+    }
 
     /// Write @Packed(X) annotation if struct is packed.
     if (isStruct && pack != null) {
@@ -126,7 +181,10 @@ abstract class Compound extends BindingType {
     s.write('${w.ffiLibraryPrefix}.${isOpaque ? 'Opaque' : dartClassName}{\n');
     const depth = '  ';
     for (final m in members) {
-      m.name = localUniqueNamer.makeUnique(m.name);
+      if (m.isBitField) {
+        _writeBitFieldAccessors(s, m);
+        continue;
+      }
       if (m.dartDoc != null) {
         s.write('$depth/// ');
         s.writeAll(m.dartDoc!.split('\n'), '\n$depth/// ');
@@ -144,13 +202,134 @@ abstract class Compound extends BindingType {
         s.write('${depth}external ${m.type.getFfiDartType(w)} ${m.name};\n\n');
       }
     }
+    if (hasLayoutTable) {
+      _writeLayoutTable(s);
+    }
     s.write('}\n\n');
 
+    if (generateOffsetAccessors && !isOpaque) {
+      _writeOffsetAccessors(s, w);
+    }
+
     return BindingString(
         type: isStruct ? BindingStringType.struct : BindingStringType.union,
         string: s.toString());
   }
 
+  /// Writes a getter and setter for the bit field [m], which mask and shift
+  /// its storage unit in place.
+  ///
+  /// Bit positions are counted from the least significant bit of the storage
+  /// unit, which matches the layout of little endian targets.
+  void _writeBitFieldAccessors(StringBuffer s, Member m) {
+    const depth = '  ';
+    final storage = m.bitFieldStorage!.name;
+    final shift = m.offsetInBits! - m.bitFieldStorage!.offsetInBits!;
+    final width = m.bitWidth!;
+    final mask = (BigInt.one << width) - BigInt.one;
+    final maskString = '0x${mask.toRadixString(16)}';
+    final shiftedMaskString = '0x${(mask << shift).toRadixString(16)}';
+    final isBool = m.type.typealiasType is BooleanType;
+    final dartType = isBool ? 'bool' : 'int';
+
+    var value = shift == 0 ? storage : '($storage >> $shift)';
+    value = '$value & $maskString';
+    if (isBool) {
+      value = '($value) != 0';
+    } else if (m.isSignedBitField && width < 64) {
+      value = '($value).toSigned($width)';
+    }
+    var newValue = '${isBool ? '(value ? 1 : 0)' : 'value'} & $maskString';
+    if (shift != 0) newValue = '($newValue) << $shift';
+
+    if (m.dartDoc != null) {
+      s.write('$depth/// ');
+      s.writeAll(m.dartDoc!.split('\n'), '\n$depth/// ');
+      s.write('\n');
+    }
+    s.write('$depth$dartType get ${m.name} => $value;\n\n');
+    s.write('${depth}set ${m.name}($dartType value) => $storage = '
+        '($storage & ~$shiftedMaskString) | ($newValue);\n\n');
+  }
+
+  /// Writes the clang computed layout as static constants.
+  void _writeLayoutTable(StringBuffer s) {
+    const depth = '  ';
+
+    s.write('$depth/// Size of [$name] in bytes, as computed by clang.\n');
+    s.write('${depth}static const int $_sizeOfName = $size;\n\n');
+    if (alignment != null) {
+      s.write('$depth/// Alignment of [$name] in bytes, as computed by '
+          'clang.\n');
+      s.write('${depth}static const int $_alignOfName = $alignment;\n\n');
+    }
+    s.write('$depth/// Offsets of the members of [$name] in bytes, as computed '
+        'by clang.\n');
+    s.write('${depth}static const Map<String, int> $_offsetOfName = {\n');
+    for (final m in members) {
+      if (m.offsetInBits == null || m.isBitField) continue;
+      s.write("$depth$depth'${m.name}': ${m.offsetInBits! ~/ 8},\n");
+    }
+    s.write('$depth};\n\n');
+  }
+
+  /// Writes an extension on `Pointer<T>` with accessors for all members of a
+  /// primitive type that read and write the member at its offset directly.
+  void _writeOffsetAccessors(StringBuffer s, Writer w) {
+    final accessorMembers = members.where((m) =>
+        m.offsetInBits != null &&
+        m.offsetInBits! % 8 == 0 &&
+        !m.isBitField &&
+        !_pointerMemberNames.contains(m.name) &&
+        _supportsOffsetAccessor(m.type));
+    if (accessorMembers.isEmpty) return;
+
+    const depth = '  ';
+    final extensionName = w.topLevelUniqueNamer.makeUnique('${name}Fields');
+    s.write('/// Accessors for the members of [$name] which skip `ref`.\n');
+    s.write('extension $extensionName on '
+        '${w.ffiLibraryPrefix}.Pointer<$name> {\n');
+    for (final m in accessorMembers) {
+      final offset = m.offsetInBits! ~/ 8;
+      final address =
+          offset == 0 ? 'this.address' : 'this.address + $offset';
+      final pointer = '${w.ffiLibraryPrefix}.Pointer<${m.type.getCType(w)}>'
+          '.fromAddress($address)';
+      final dartType = m.type.getFfiDartType(w);
+      s.write('$depth$dartType get ${m.name} => $pointer.value;\n\n');
+      s.write('${depth}set ${m.name}($dartType value) => '
+          '$pointer.value = value;\n\n');
+    }
+    s.write('}\n\n');
+  }
+
+  /// Members of `Pointer` which would hide an extension member of that name.
+  static const _pointerMemberNames = {
+    'address',
+    'cast',
+    'elementAt',
+    'hashCode',
+    'noSuchMethod',
+    'ref',
+    'runtimeType',
+    'toString',
+    'value',
+  };
+
+  /// Returns true if [type] can be read using `Pointer<T>.value`.
+  static bool _supportsOffsetAccessor(Type type) {
+    final baseType = type.typealiasType;
+    if (baseType is ConstantArray || baseType is IncompleteArray) {
+      return false;
+    }
+    return baseType is PointerType ||
+        baseType is NativeType ||
+        baseType is EnumClass ||
+        (baseType is ImportedType &&
+            baseType.libraryImport == ffiImport &&
+            baseType != voidType);
+  }
+
   @override
   void addDependencies(Set<Binding> dependencies) {
     if (dependencies.contains(this)) return;
@@ -177,10 +356,29 @@ class Member {
   String name;
   final Type type;
 
+  /// Offset of this member in bits, as computed by clang. Null if unknown.
+  final int? offsetInBits;
+
+  /// Width in bits if this member is a bit field, null otherwise.
+  final int? bitWidth;
+
+  /// Whether this bit field has a signed type, and should be sign extended.
+  final bool isSignedBitField;
+
+  /// The member holding the storage unit of this bit field. Bit fields are
+  /// written as accessors which mask and shift the storage unit.
+  Member? bitFieldStorage;
+
   Member({
     String? originalName,
     required this.name,
     required this.type,
     this.dartDoc,
+    this.offsetInBits,
+    this.bitWidth,
+    this.isSignedBitField = false,
+    this.bitFieldStorage,
   }) : originalName = originalName ?? name;
+
+  bool get isBitField => bitWidth != null;
 }
@@ -0,0 +1,270 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:collection';
+
+import 'package:ffigen/src/code_generator.dart';
+
+/// Dependencies between bindings, kept across several [Library]s so that only
+/// the declarations which changed are traversed again.
+///
+/// The direct dependencies of each binding are found once, by calling its
+/// [Binding.addDependencies] with a set in which every other binding is
+/// already present, and are memoized as USRs. Each USR is resolved to the
+/// latest object seen for it, so unchanged declarations can be replaced by
+/// new objects, e.g. when they're read again by [updateDeclarations].
+///
+/// A binding is traversed again if it's marked with [markDirty] after being
+/// changed in place, or if it's replaced by another object with the same USR.
+/// The bindings depending on a replaced binding are traversed again as well,
+/// to find the objects they now refer to.
+///
+/// Walking the memoized graph depth first lists the bindings in the same order
+/// as calling [Binding.addDependencies] on all of them with a shared set, so a
+/// library built from the graph is identical to a full rebuild.
+///
+/// ObjC interfaces and blocks collect their dependencies with side effects
+/// that depend on the traversal order, so libraries containing them are
+/// always traversed in full. So are libraries with several objects for the
+/// same USR.
+class DependencyGraph {
+  final _nodes = <String, _DependencyNode>{};
+
+  /// USRs of the bindings which depend directly on each binding.
+  final _dependents = <String, Set<String>>{};
+
+  /// Fingerprints of the declarations given to [updateDeclarations].
+  var _fingerprints = <String, String>{};
+
+  /// Number of bindings whose dependencies were found by the last [closure],
+  /// instead of being read from the graph.
+  int get lastTraversalCount => _lastTraversalCount;
+  int _lastTraversalCount = 0;
+
+  /// Marks the binding with [usr] as changed, so that its dependencies are
+  /// found again by the next [closure].
+  void markDirty(String usr) {
+    _nodes[usr]?.isDirty = true;
+  }
+
+  /// Marks the bindings depending directly on [usr] as changed.
+  void _markDependentsDirty(String usr) {
+    for (final dependent in _dependents[usr] ?? const <String>{}) {
+      markDirty(dependent);
+    }
+  }
+
+  /// Replaces the bindings in the graph by the objects in [declarations],
+  /// keyed by USR, such as the declarations read again from a declaration IR
+  /// file.
+  ///
+  /// Declarations whose entry in [fingerprints] changed since the last update
+  /// are marked dirty. Bindings which are not in [declarations], such as the
+  /// typedefs created for a function, are removed from the graph, and the
+  /// bindings depending on them are traversed again to find their new objects.
+  void updateDeclarations(
+      Map<String, Binding> declarations, Map<String, String> fingerprints) {
+    for (final usr in _nodes.keys.toList()) {
+      final binding = declarations[usr];
+      if (binding == null) {
+        _removeNode(usr);
+        continue;
+      }
+      _nodes[usr]!.replaceBinding(binding);
+      if (_fingerprints[usr] != fingerprints[usr]) {
+        markDirty(usr);
+      }
+    }
+    _fingerprints = fingerprints;
+  }
+
+  void _removeNode(String usr) {
+    final node = _nodes.remove(usr)!;
+    _markDependentsDirty(usr);
+    for (final dependency in node.dependencies) {
+      _dependents[dependency]?.remove(usr);
+    }
+  }
+
+  /// Returns [roots] and all their dependencies, in the order they're added
+  /// by [Binding.addDependencies].
+  ///
+  /// Returns null if the dependencies can't be memoized, in which case no
+  /// binding has been changed.
+  List<Binding>? closure(List<Binding> roots) {
+    _lastTraversalCount = 0;
+    final dependencies = <String>{};
+    try {
+      for (final b in roots) {
+        _visit(b, dependencies);
+      }
+    } on _FullTraversalException {
+      return null;
+    }
+    return [for (final usr in dependencies) _nodes[usr]!.binding];
+  }
+
+  void _visit(Binding b, Set<String> dependencies) {
+    if (!dependencies.add(b.usr)) {
+      // Another object with the same USR was already visited.
+      if (!identical(_nodes[b.usr]!.binding, b)) {
+        throw _FullTraversalException();
+      }
+      return;
+    }
+    for (final d in _directDependencies(b)) {
+      _visit(d, dependencies);
+    }
+  }
+
+  List<Binding> _directDependencies(Binding b) {
+    var node = _nodes[b.usr];
+    if (node != null && !identical(node.binding, b)) {
+      node
+        ..replaceBinding(b)
+        ..isDirty = true;
+      _markDependentsDirty(b.usr);
+    }
+    if (node != null &&
+        !node.isDirty &&
+        node.dependencies.every(_nodes.containsKey)) {
+      return [for (final usr in node.dependencies) _nodes[usr]!.binding];
+    }
+    if (b is ObjCInterface || b is ObjCBlock) {
+      throw _FullTraversalException();
+    }
+
+    final recorder = _DependencyRecorder(b);
+    b.addDependencies(recorder);
+    _lastTraversalCount++;
+    node ??= _nodes[b.usr] = _DependencyNode(b);
+    for (final dependency in node.dependencies) {
+      _dependents[dependency]?.remove(b.usr);
+    }
+    node
+      ..dependencies = [for (final d in recorder.dependencies) d.usr]
+      ..isDirty = false;
+    for (final dependency in node.dependencies) {
+      (_dependents[dependency] ??= {}).add(b.usr);
+    }
+    return recorder.dependencies;
+  }
+
+  /// Resets [b] to the name and pack value it had before it was added to a
+  /// library, undoing the changes of an earlier [Library].
+  ///
+  /// Changes made to [b] since then are kept.
+  void resetDeclaration(Binding b) {
+    final node = _nodes[b.usr];
+    if (node == null || !identical(node.binding, b)) return;
+
+    if (node.hasResolution && b.name == node.resolvedName) {
+      b.name = node.declarationName;
+    } else {
+      node.declarationName = b.name;
+    }
+    if (b is Struct) {
+      if (node.hasResolution && b.pack == node.resolvedPack) {
+        b.pack = node.declarationPack;
+      } else {
+        node.declarationPack = b.pack;
+      }
+    }
+  }
+
+  /// Saves the name and pack value [b] got in a library, so that they can be
+  /// reset by [resetDeclaration].
+  void saveResolution(Binding b) {
+    final node = _nodes[b.usr];
+    if (node == null || !identical(node.binding, b)) return;
+
+    node
+      ..hasResolution = true
+      ..resolvedName = b.name
+      ..resolvedPack = b is Struct ? b.pack : null;
+  }
+}
+
+class _DependencyNode {
+  /// The latest object seen for the USR of this node.
+  Binding binding;
+
+  /// USRs of the direct dependencies.
+  List<String> dependencies = const [];
+  bool isDirty = false;
+
+  /// The name and pack value before name conflicts and packing overrides
+  /// have been applied by a [Library].
+  String declarationName;
+  int? declarationPack;
+
+  /// The name and pack value after they have been applied.
+  bool hasResolution = false;
+  String? resolvedName;
+  int? resolvedPack;
+
+  _DependencyNode(this.binding)
+      : declarationName = binding.name,
+        declarationPack = binding is Struct ? binding.pack : null;
+
+  /// Replaces [binding] by [b], a new object for the same declaration which
+  /// hasn't been added to a library yet.
+  void replaceBinding(Binding b) {
+    if (identical(binding, b)) return;
+    binding = b;
+    declarationName = b.name;
+    declarationPack = b is Struct ? b.pack : null;
+    hasResolution = false;
+  }
+}
+
+/// Set passed to [Binding.addDependencies] to record the bindings it depends
+/// on directly.
+///
+/// Every binding other than [binding] is reported as already present, so that
+/// their own dependencies are not traversed.
+class _DependencyRecorder extends SetBase<Binding> {
+  final Binding binding;
+  final dependencies = <Binding>[];
+  bool _isAdded = false;
+
+  _DependencyRecorder(this.binding);
+
+  @override
+  bool add(Binding value) {
+    if (identical(value, binding)) {
+      final wasAdded = _isAdded;
+      _isAdded = true;
+      return !wasAdded;
+    }
+    dependencies.add(value);
+    return false;
+  }
+
+  @override
+  bool contains(Object? element) {
+    if (identical(element, binding)) return _isAdded;
+    if (element is Binding) dependencies.add(element);
+    return true;
+  }
+
+  @override
+  Binding? lookup(Object? element) =>
+      contains(element) ? element as Binding : null;
+
+  @override
+  bool remove(Object? value) => throw UnsupportedError('remove');
+
+  @override
+  Iterator<Binding> get iterator =>
+      [if (_isAdded) binding, ...dependencies].iterator;
+
+  @override
+  int get length => (_isAdded ? 1 : 0) + dependencies.length;
+
+  @override
+  Set<Binding> toSet() => {if (_isAdded) binding, ...dependencies};
+}
+
+class _FullTraversalException implements Exception {}
@@ -23,17 +23,44 @@ import 'writer.dart';
 ///   static const banana = 10;
 /// }
 /// ```
+///
+/// If [generateAsDartEnum] is true, a Dart enum is generated instead -
+///
+/// ```dart
+/// enum Fruits {
+///   apple(0),
+///   banana(10);
+///
+///   const Fruits(this.value);
+///
+///   final int value;
+///
+///   static const _byValue = <int, Fruits>{0: apple, 10: banana};
+///
+///   static Fruits fromValue(int value) {...}
+/// }
+/// ```
 class EnumClass extends BindingType {
   static final nativeType = NativeType(SupportedNativeType.Int32);
 
+  /// The values of a Dart enum are looked up by indexing a list, if at least
+  /// this fraction of the range between its smallest and largest value is
+  /// used. Otherwise a map is used.
+  static const _denseLookupMinFill = 0.5;
+
   final List<EnumConstant> enumConstants;
 
+  /// Generate a Dart enum with a `fromValue` lookup instead of a class of int
+  /// constants.
+  final bool generateAsDartEnum;
+
   EnumClass({
     super.usr,
     super.originalName,
     required super.name,
     super.dartDoc,
     List<EnumConstant>? enumConstants,
+    this.generateAsDartEnum = false,
   }) : enumConstants = enumConstants ?? [];
 
   @override
@@ -45,6 +72,13 @@ class EnumClass extends BindingType {
       s.write(makeDartDoc(dartDoc!));
     }
 
+    // A Dart enum needs at least one value.
+    if (generateAsDartEnum && enumConstants.isNotEmpty) {
+      _writeDartEnum(s);
+      return BindingString(
+          type: BindingStringType.enumClass, string: s.toString());
+    }
+
     /// Adding [enclosingClassName] because dart doesn't allow class member
     /// to have the same name as the class.
     final localUniqueNamer = UniqueNamer({enclosingClassName});
@@ -67,6 +101,108 @@ class EnumClass extends BindingType {
         type: BindingStringType.enumClass, string: s.toString());
   }
 
+  void _writeDartEnum(StringBuffer s) {
+    // Members of every enum, which can't be used as names of its values.
+    final localUniqueNamer = UniqueNamer({
+      name,
+      'values',
+      'index',
+      'name',
+      'value',
+      'fromValue',
+      '_byValue',
+      'hashCode',
+      'runtimeType',
+      'toString',
+      'noSuchMethod',
+    });
+    const depth = '  ';
+    void writeDoc(EnumConstant ec) {
+      if (ec.dartDoc != null) {
+        s.write('$depth/// ');
+        s.writeAll(ec.dartDoc!.split('\n'), '\n$depth/// ');
+        s.write('\n');
+      }
+    }
+
+    // C allows several constants with the same value. Only the first one
+    // becomes a value of the Dart enum, the others are aliases of it.
+    final byValue = <int, String>{};
+    final aliases = <(EnumConstant, String, String)>[];
+    final values = <(EnumConstant, String)>[];
+    for (final ec in enumConstants) {
+      final enumValueName = localUniqueNamer.makeUnique(ec.name);
+      final first = byValue[ec.value];
+      if (first == null) {
+        byValue[ec.value] = enumValueName;
+        values.add((ec, enumValueName));
+      } else {
+        aliases.add((ec, enumValueName, first));
+      }
+    }
+
+    s.write('enum $name {\n');
+    for (var i = 0; i < values.length; i++) {
+      final (ec, enumValueName) = values[i];
+      if (i > 0 && ec.dartDoc != null) s.write('\n');
+      writeDoc(ec);
+      s.write('$depth$enumValueName(${ec.value})');
+      s.write(i == values.length - 1 ? ';\n' : ',\n');
+    }
+    s.write('\n');
+    for (final (ec, aliasName, first) in aliases) {
+      writeDoc(ec);
+      s.write('${depth}static const $aliasName = $first;\n\n');
+    }
+    s.write('${depth}const $name(this.value);\n\n');
+    s.write('$depth/// The value of this constant in C.\n');
+    s.write('${depth}final int value;\n\n');
+
+    final min = byValue.keys.reduce((a, b) => a < b ? a : b);
+    final max = byValue.keys.reduce((a, b) => a > b ? a : b);
+    final range = max - min + 1;
+    final String lookup;
+    if (range > 0 && byValue.length >= range * _denseLookupMinFill) {
+      // Dense values, stored at their offset from the smallest value.
+      final index = min == 0
+          ? 'value'
+          : min < 0
+              ? 'value + ${-min}'
+              : 'value - $min';
+      s.write('${depth}static const _byValue = <$name?>[\n');
+      for (var v = min; v <= max; v++) {
+        s.write('$depth$depth${byValue[v] ?? 'null'},\n');
+      }
+      s.write('$depth];\n\n');
+      lookup = '''
+    final index = $index;
+    final result =
+        index >= 0 && index < _byValue.length ? _byValue[index] : null;
+''';
+    } else {
+      s.write('${depth}static const _byValue = <int, $name>{\n');
+      for (final MapEntry(key: v, value: n) in byValue.entries) {
+        s.write('$depth$depth$v: $n,\n');
+      }
+      s.write('$depth};\n\n');
+      lookup = '''
+    final result = _byValue[value];
+''';
+    }
+    s.write('''
+$depth/// Returns the constant with [value], throws an [ArgumentError] if there
+$depth/// is none.
+${depth}static $name fromValue(int value) {
+$lookup    if (result == null) {
+      throw ArgumentError.value(value, 'value', 'Unknown value for $name.');
+    }
+    return result;
+  }
+}
+
+''');
+  }
+
   @override
   void addDependencies(Set<Binding> dependencies) {
     if (dependencies.contains(this)) return;
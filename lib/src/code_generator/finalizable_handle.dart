@@ -0,0 +1,134 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:ffigen/src/code_generator.dart';
+
+import 'binding_string.dart';
+import 'writer.dart';
+
+/// A class owning a pointer to a native struct, which is released by a
+/// destructor function when the object is disposed or garbage collected.
+///
+/// Expands to -
+/// ```dart
+/// final class FooHandle implements ffi.Finalizable {
+///   FooHandle._(...) {
+///     _finalizer.attach(this, _pointer.cast(), detach: this,
+///         externalSize: externalSize);
+///   }
+///
+///   factory FooHandle(NativeLibrary lib, ffi.Pointer<Foo> pointer) {...}
+///
+///   ffi.Pointer<Foo> get pointer {...}
+///
+///   void dispose() {...}
+/// }
+/// ```
+///
+/// The native finalizer is created once for each instance of the wrapper
+/// class, from the address of the [destructor] looked up by it.
+class FinalizableHandle extends NoLookUpBinding {
+  final Compound compound;
+
+  /// Releases the struct, takes a pointer to it and returns void.
+  final Func destructor;
+
+  /// Returns the native memory owned by the struct, which is reported to the
+  /// garbage collector as the external size of the handle.
+  final Func? size;
+
+  FinalizableHandle({
+    required this.compound,
+    required this.destructor,
+    this.size,
+  }) : super(
+          usr: '${compound.usr}@Handle',
+          originalName: '${compound.originalName}Handle',
+          name: '${compound.name}Handle',
+        );
+
+  @override
+  BindingString toBindingString(Writer w) {
+    final s = StringBuffer();
+    final ffi = w.ffiLibraryPrefix;
+    final pointerType = '$ffi.Pointer<${compound.name}>';
+    final releaseType = 'void Function($ffi.Pointer<$ffi.Void>)';
+    final sizeCall = size == null
+        ? '0'
+        : '${size!.ffiNativeConfig.enabled ? '' : 'lib.'}'
+            '${size!.name}(pointer)';
+
+    s.write('''
+/// Owns a [${compound.name}], which is released with `${destructor.originalName}`.
+///
+/// The struct is released by [dispose], or by a native finalizer once this
+/// handle is garbage collected.
+final class $name implements $ffi.Finalizable {
+  static final _finalizers = Expando<$ffi.NativeFinalizer>();
+  static final _releases = Expando<$releaseType>();
+
+  $pointerType _pointer;
+  final $ffi.NativeFinalizer _finalizer;
+  final $releaseType _release;
+
+  /// Native memory owned by the struct in bytes, as reported to the garbage
+  /// collector.
+  final int externalSize;
+
+  $name._(this._pointer, this._finalizer, this._release, this.externalSize) {
+    _finalizer.attach(this, _pointer.cast(),
+        detach: this, externalSize: externalSize);
+  }
+
+  /// Takes ownership of [pointer], which must have been created by [lib].
+  factory $name(${w.className} lib, $pointerType pointer) {
+    var finalizer = _finalizers[lib];
+    var release = _releases[lib];
+    if (finalizer == null || release == null) {
+      final destructor = lib.${w.lookupFuncIdentifier}<$ffi.NativeFinalizerFunction>(
+          '${destructor.originalName}');
+      finalizer = $ffi.NativeFinalizer(destructor);
+      release = destructor.asFunction<$releaseType>();
+      _finalizers[lib] = finalizer;
+      _releases[lib] = release;
+    }
+    return $name._(pointer, finalizer, release, $sizeCall);
+  }
+
+  /// The owned pointer, throws a [StateError] once this has been disposed.
+  $pointerType get pointer {
+    if (_pointer == $ffi.nullptr) {
+      throw StateError('$name has already been disposed.');
+    }
+    return _pointer;
+  }
+
+  bool get isDisposed => _pointer == $ffi.nullptr;
+
+  /// Releases the struct now, instead of when this handle is garbage
+  /// collected. Does nothing if this has already been disposed.
+  void dispose() {
+    if (_pointer == $ffi.nullptr) return;
+    _finalizer.detach(this);
+    _release(_pointer.cast());
+    _pointer = $ffi.nullptr;
+  }
+}
+
+''');
+
+    return BindingString(
+        type: BindingStringType.finalizableHandle, string: s.toString());
+  }
+
+  @override
+  void addDependencies(Set<Binding> dependencies) {
+    if (dependencies.contains(this)) return;
+
+    dependencies.add(this);
+    compound.addDependencies(dependencies);
+    destructor.addDependencies(dependencies);
+    size?.addDependencies(dependencies);
+  }
+}
@@ -44,7 +44,30 @@ class Func extends LookUpBinding {
   final bool isLeaf;
   final bool objCReturnsRetained;
   final FfiNativeConfig ffiNativeConfig;
-  late final String funcPointerName;
+
+  /// If true, a wrapper taking Dart [String]s for the `char*` parameters, and
+  /// returning a [String] for a `char*` return type, is also generated.
+  final bool stringWrapper;
+
+  /// If true, the string wrapper passes the encoded length of a string to an
+  /// integer length parameter directly following it, instead of exposing it.
+  final bool stringLengthArguments;
+
+  /// If true, and the function can be batched, a C shim calling it for each
+  /// element of its argument arrays is bound as well, together with a wrapper
+  /// taking typed data. See [canBatch].
+  final bool batchWrapper;
+
+  /// Binding of the batch shim, if any.
+  Func? _batchFunc;
+
+  /// Name of the function pointer looked up in the wrapper class, set by
+  /// [toBindingString].
+  String get funcPointerName => _funcPointerName!;
+  String? _funcPointerName;
+
+  /// Names of the parameters, set by [resolveRenderNames].
+  final _parameterNames = ResolvedNames<Parameter>();
 
   /// Contains typealias for function type if [exposeFunctionTypedefs] is true.
   Typealias? _exposedFunctionTypealias;
@@ -65,6 +88,9 @@ class Func extends LookUpBinding {
     this.objCReturnsRetained = false,
     super.isInternal,
     this.ffiNativeConfig = const FfiNativeConfig(enabled: false),
+    this.stringWrapper = false,
+    this.stringLengthArguments = false,
+    this.batchWrapper = false,
   })  : functionType = FunctionType(
           returnType: returnType,
           parameters: parameters ?? const [],
@@ -89,6 +115,51 @@ class Func extends LookUpBinding {
         isInternal: true,
       );
     }
+
+    if (batchWrapper && canBatch(functionType)) {
+      final namer =
+          UniqueNamer(functionType.parameters.map((p) => p.name).toSet());
+      final resultName = namer.makeUnique('result');
+      final countName = namer.makeUnique('count');
+      _batchFunc = Func(
+        name: '${name}Batch',
+        originalName: batchShimName(this.originalName),
+        dartDoc: 'Calls [$name] once for each element of the arrays.\n\n'
+            'The arrays have [$countName] elements each, and all calls are made '
+            'in a\nsingle FFI call.',
+        returnType: voidType,
+        parameters: [
+          for (final p in functionType.parameters)
+            Parameter(
+                name: p.name,
+                type: PointerType(
+                    NativeType(batchElementType(p.type)!.nativeType))),
+          if (!batchReturnsVoid(this))
+            Parameter(
+                name: resultName,
+                type: PointerType(NativeType(
+                    batchElementType(functionType.returnType)!.nativeType))),
+          Parameter(name: countName, type: sizeType),
+        ],
+        isLeaf: isLeaf,
+        ffiNativeConfig: ffiNativeConfig,
+      );
+    }
+  }
+
+  /// The C source of the batch shim, if this function has one.
+  String? get batchShimSource =>
+      _batchFunc == null ? null : batchShimCSource(this);
+
+  @override
+  void resolveRenderNames(Writer w) {
+    // Resolve name conflicts in function parameter names.
+    final paramNamer = UniqueNamer({});
+    for (final p in functionType.dartTypeParameters) {
+      final declared = _parameterNames.declared(p, p.name);
+      p.name = paramNamer.makeUnique(declared);
+      _parameterNames.save(p, declared, p.name);
+    }
   }
 
   @override
@@ -99,17 +170,13 @@ class Func extends LookUpBinding {
     if (dartDoc != null) {
       s.write(makeDartDoc(dartDoc!));
     }
-    // Resolve name conflicts in function parameter names.
-    final paramNamer = UniqueNamer({});
-    for (final p in functionType.dartTypeParameters) {
-      p.name = paramNamer.makeUnique(p.name);
-    }
 
     final cType = _exposedFunctionTypealias?.getCType(w) ??
         functionType.getCType(w, writeArgumentNames: false);
     final dartType = _exposedFunctionTypealias?.getFfiDartType(w) ??
         functionType.getFfiDartType(w, writeArgumentNames: false);
     final needsWrapper = !functionType.sameDartAndFfiDartType && !isInternal;
+    var libArg = '';
 
     final isLeafString = isLeaf ? 'isLeaf:true' : '';
     final funcVarName = w.wrapperLevelUniqueNamer.makeUnique('_$name');
@@ -156,7 +223,7 @@ external $ffiReturnType $nativeFuncName($ffiArgDeclString);
 
 ''');
       if (needsWrapper) {
-        final libArg = functionType.returnType.sameDartAndFfiDartType
+        libArg = functionType.returnType.sameDartAndFfiDartType
             ? ''
             : '${w.className} lib, ';
         s.write('''
@@ -164,8 +231,14 @@ $dartReturnType $enclosingFuncName($libArg$dartArgDeclString) => $funcImplCall;
 
 ''');
       }
+      if (stringWrapper) {
+        s.write(_stringWrapperString(w, needsWrapper, libArg));
+      }
+      if (_batchFunc != null) {
+        s.write(_batchListWrapperString(w));
+      }
     } else {
-      funcPointerName = w.wrapperLevelUniqueNamer.makeUnique('_${name}Ptr');
+      _funcPointerName = w.wrapperLevelUniqueNamer.makeUnique('_${name}Ptr');
 
       // Write enclosing function.
       s.write('''
@@ -174,6 +247,12 @@ $dartReturnType $enclosingFuncName($dartArgDeclString) {
 }
 
 ''');
+      if (stringWrapper) {
+        s.write(_stringWrapperString(w, needsWrapper, libArg));
+      }
+      if (_batchFunc != null) {
+        s.write(_batchListWrapperString(w));
+      }
 
       if (exposeSymbolAddress) {
         // Add to SymbolAddress in writer.
@@ -197,6 +276,203 @@ late final $funcVarName = $funcPointerName.asFunction<$dartType>($isLeafString);
     return BindingString(type: BindingStringType.func, string: s.toString());
   }
 
+  /// Writes a wrapper around the function named [name] which takes Dart
+  /// strings instead of `const char*`, and decodes a `const char*` return
+  /// value.
+  ///
+  /// The strings are encoded into the scratch arena of the [Writer], so short
+  /// strings don't need a native allocation per call.
+  String _stringWrapperString(Writer w, bool needsWrapper, String libArg) {
+    final params = functionType.dartTypeParameters;
+    final returnsString = _isConstCharPointer(functionType.returnType);
+    if (!returnsString && !params.any((p) => _isConstCharPointer(p.type))) {
+      return '';
+    }
+
+    final scratch = w.stringScratchClassName;
+    final wrapperName = (ffiNativeConfig.enabled
+            ? w.topLevelUniqueNamer
+            : w.wrapperLevelUniqueNamer)
+        .makeUnique('${name}Str');
+    final localNamer = UniqueNamer(params.map((p) => p.name).toSet());
+    final markName = localNamer.makeUnique('mark');
+    final maxLengthName = localNamer.makeUnique('maxLength');
+
+    final decls = <String>[];
+    final conversions = StringBuffer();
+    final args = <String>[];
+    for (var i = 0; i < params.length; i++) {
+      final p = params[i];
+      if (!_isConstCharPointer(p.type)) {
+        final type =
+            needsWrapper ? p.type.getDartType(w) : p.type.getFfiDartType(w);
+        decls.add('$type ${p.name}');
+        args.add(p.name);
+        continue;
+      }
+      final ptrName = localNamer.makeUnique('${p.name}Ptr');
+      decls.add('String ${p.name}');
+      args.add(ptrName);
+      final charCType =
+          (p.type.typealiasType as PointerType).child.getCType(w);
+      conversions.write('    final $ptrName = '
+          '$scratch.toNative(${p.name}).cast<$charCType>();\n');
+      if (stringLengthArguments &&
+          i + 1 < params.length &&
+          _isLengthParameter(params[i + 1])) {
+        final lengthName = localNamer.makeUnique('${p.name}Length');
+        conversions.write('    final $lengthName = $scratch.lastLength;\n');
+        args.add(lengthName);
+        i++;
+      }
+    }
+
+    final libCallArg = libArg.isEmpty ? '' : 'lib, ';
+    final call = '$name($libCallArg${args.join(', ')})';
+    final String returnType;
+    final String result;
+    if (returnsString) {
+      returnType = 'String?';
+      result = '$scratch.fromNative($call.cast(), $maxLengthName)';
+    } else {
+      returnType = needsWrapper
+          ? functionType.returnType.getDartType(w)
+          : functionType.returnType.getFfiDartType(w);
+      result = call;
+    }
+    final paramsString = [
+      if (libArg.isNotEmpty) '${w.className} lib',
+      ...decls,
+      if (returnsString) '{int? $maxLengthName}',
+    ].join(', ');
+
+    final s = StringBuffer();
+    s.write('/// Calls [$name] with Dart strings, encoded as UTF-8.\n');
+    if (returnsString) {
+      s.write('///\n/// The result is decoded up to the first NUL, or at most '
+          '[$maxLengthName] bytes.\n');
+    }
+    s.write('''
+$returnType $wrapperName($paramsString) {
+  final $markName = $scratch.mark;
+  try {
+$conversions    return $result;
+  } finally {
+    $scratch.release($markName);
+  }
+}
+
+''');
+    return s.toString();
+  }
+
+  /// Writes a wrapper around the batch shim which copies typed data to and
+  /// from native memory.
+  String _batchListWrapperString(Writer w) {
+    final batchFunc = _batchFunc!;
+    final params = functionType.parameters;
+    final returnsVoid = batchReturnsVoid(this);
+    final typedData = w.typedDataLibraryPrefix;
+    final malloc = '${w.ffiPkgLibraryPrefix}.malloc';
+    final wrapperName = (ffiNativeConfig.enabled
+            ? w.topLevelUniqueNamer
+            : w.wrapperLevelUniqueNamer)
+        .makeUnique('${name}BatchList');
+    final localNamer = UniqueNamer(params.map((p) => p.name).toSet());
+    final countName = localNamer.makeUnique('count');
+
+    String listType(Type t) =>
+        '$typedData.${batchElementType(t)!.typedDataClass}';
+    String elementType(Type t) =>
+        NativeType(batchElementType(t)!.nativeType).getCType(w);
+
+    final pointers = <String, String>{};
+    final checks = StringBuffer();
+    final allocations = StringBuffer();
+    final copies = StringBuffer();
+    final frees = StringBuffer();
+    for (final p in params) {
+      final ptrName = localNamer.makeUnique('${p.name}Ptr');
+      pointers[p.name] = ptrName;
+      if (p != params.first) {
+        checks.write('''
+  if (${p.name}.length != $countName) {
+    throw ArgumentError.value(${p.name}, '${p.name}', 'Expected \$$countName elements.');
+  }
+''');
+      }
+      allocations.write('  final $ptrName = $malloc<${elementType(p.type)}>'
+          '($countName);\n');
+      copies.write(
+          '    $ptrName.asTypedList($countName).setAll(0, ${p.name});\n');
+      frees.write('    $malloc.free($ptrName);\n');
+    }
+    final resultPtrName = localNamer.makeUnique('resultPtr');
+    if (!returnsVoid) {
+      allocations.write('  final $resultPtrName = '
+          '$malloc<${elementType(functionType.returnType)}>($countName);\n');
+      frees.write('    $malloc.free($resultPtrName);\n');
+    }
+
+    final returnType =
+        returnsVoid ? 'void' : listType(functionType.returnType);
+    final emptyResult =
+        returnsVoid ? '' : ' ${listType(functionType.returnType)}(0)';
+    final args = [
+      ...pointers.values,
+      if (!returnsVoid) resultPtrName,
+      countName,
+    ].join(', ');
+    final call = '${batchFunc.name}($args);';
+    final result = returnsVoid
+        ? '    $call\n'
+        : '    $call\n    return ${listType(functionType.returnType)}'
+            '.fromList($resultPtrName.asTypedList($countName));\n';
+
+    return '''
+/// Calls [$name] once for each element of the lists.
+///
+/// The lists must have the same length. They are copied to native memory, so
+/// that all calls are made in a single FFI call.
+$returnType $wrapperName(${params.map((p) => '${listType(p.type)} ${p.name}').join(', ')}) {
+  final $countName = ${params.first.name}.length;
+$checks  if ($countName == 0) return$emptyResult;
+$allocations  try {
+$copies$result  } finally {
+$frees  }
+}
+
+''';
+  }
+
+  static bool _isCharPointer(Type type) {
+    final t = type.typealiasType;
+    if (t is! PointerType) return false;
+    final child = t.child.typealiasType;
+    return child == charType ||
+        child == signedCharType ||
+        child == unsignedCharType;
+  }
+
+  /// True if [type] is a `const char*`, which C only reads.
+  ///
+  /// Other `char*` parameters may be buffers the function writes to, and other
+  /// `char*` return values are usually owned by the caller, so they are passed
+  /// through unchanged.
+  static bool _isConstCharPointer(Type type) =>
+      _isCharPointer(type) && (type.typealiasType as PointerType).isConst;
+
+  static final _lengthParameterRegexp =
+      RegExp(r'(^n|len|length|size)$', caseSensitive: false);
+
+  static bool _isLengthParameter(Parameter p) {
+    final type = p.type.typealiasType;
+    return type is ImportedType &&
+        type.libraryImport == ffiImport &&
+        type.dartType == 'int' &&
+        _lengthParameterRegexp.hasMatch(p.name);
+  }
+
   @override
   void addDependencies(Set<Binding> dependencies) {
     if (dependencies.contains(this)) return;
@@ -206,6 +482,7 @@ late final $funcVarName = $funcPointerName.asFunction<$dartType>($isLeafString);
     if (exposeFunctionTypedefs) {
       _exposedFunctionTypealias!.addDependencies(dependencies);
     }
+    _batchFunc?.addDependencies(dependencies);
   }
 }
 
@@ -33,52 +33,64 @@ class Library {
     bool sort = false,
     StructPackingOverride? packingOverride,
     Set<LibraryImport>? libraryImports,
+    bool verifyCompoundLayouts = false,
+    bool sharedSymbolTable = false,
+    DependencyGraph? dependencyGraph,
   }) {
     /// Get all dependencies (includes itself).
-    final dependencies = <Binding>{};
-    for (final b in bindings) {
-      b.addDependencies(dependencies);
+    ///
+    /// If a [dependencyGraph] is given, only bindings which changed since the
+    /// last library built from it are traversed, and the names and pack
+    /// values set by that library are reset, so that the result is the same
+    /// as a full rebuild.
+    final graphDependencies = dependencyGraph?.closure(bindings);
+    final graph = graphDependencies == null ? null : dependencyGraph;
+    if (graphDependencies == null) {
+      final dependencies = <Binding>{};
+      for (final b in bindings) {
+        b.addDependencies(dependencies);
+      }
+      this.bindings = dependencies.toList();
+    } else {
+      this.bindings = graphDependencies;
+      for (final b in this.bindings) {
+        graph!.resetDeclaration(b);
+      }
     }
 
-    /// Save bindings.
-    this.bindings = dependencies.toList();
-
     if (sort) {
       _sort();
     }
 
     /// Handle any declaration-declaration name conflicts and emit warnings.
     final declConflictHandler = UniqueNamer({});
+    final lookUpBindings = <LookUpBinding>[];
+    final ffiNativeBindings = <Func>[];
+    final noLookUpBindings = <NoLookUpBinding>[];
     for (final b in this.bindings) {
       _warnIfPrivateDeclaration(b);
       _resolveIfNameConflicts(declConflictHandler, b);
       _warnIfExposeSymbolAddressAndFfiNative(b);
-    }
 
-    // Override pack values according to config. We do this after declaration
-    // conflicts have been handled so that users can target the generated names.
-    if (packingOverride != null) {
-      for (final b in this.bindings) {
-        if (b is Struct && packingOverride.isOverriden(b.name)) {
-          b.pack = packingOverride.getOverridenPackValue(b.name);
-        }
+      // Override pack values according to config. We do this after
+      // declaration conflicts have been handled so that users can target the
+      // generated names.
+      if (packingOverride != null &&
+          b is Struct &&
+          packingOverride.isOverriden(b.name)) {
+        b.pack = packingOverride.getOverridenPackValue(b.name);
       }
-    }
-
-    // Seperate bindings which require lookup.
-    final lookUpBindings = this.bindings.whereType<LookUpBinding>().where((e) {
-      if (e is Func) {
-        return !e.ffiNativeConfig.enabled;
+      graph?.saveResolution(b);
+
+      // Seperate bindings which require lookup.
+      if (b is Func && b.ffiNativeConfig.enabled) {
+        ffiNativeBindings.add(b);
+      } else if (b is LookUpBinding) {
+        lookUpBindings.add(b);
+      } else if (b is NoLookUpBinding) {
+        noLookUpBindings.add(b);
       }
-      return true;
-    }).toList();
-    final ffiNativeBindings = this
-        .bindings
-        .whereType<Func>()
-        .where((e) => e.ffiNativeConfig.enabled)
-        .toList();
-    final noLookUpBindings =
-        this.bindings.whereType<NoLookUpBinding>().toList();
+    }
 
     _writer = Writer(
       lookUpBindings: lookUpBindings,
@@ -88,6 +100,8 @@ class Library {
       classDocComment: description,
       header: header,
       additionalImports: libraryImports,
+      verifyCompoundLayouts: verifyCompoundLayouts,
+      sharedSymbolTable: sharedSymbolTable,
     );
   }
 
@@ -139,6 +153,29 @@ class Library {
     }
   }
 
+  /// Number of bindings above which [generateFileInParallel] uses more than
+  /// one isolate by default. Every isolate gets a copy of all the bindings, so
+  /// this doesn't pay off for small libraries.
+  static const parallelRenderingThreshold = 2000;
+
+  /// Generates [file] like [generateFile], rendering the bindings on [jobs]
+  /// isolates.
+  ///
+  /// By default, uses one isolate per processor for libraries with at least
+  /// [parallelRenderingThreshold] bindings.
+  Future<void> generateFileInParallel(File file,
+      {bool format = true, int? jobs}) async {
+    jobs ??= bindings.length < parallelRenderingThreshold
+        ? 1
+        : Platform.numberOfProcessors;
+    final generated = await generateInParallel(jobs: jobs);
+    if (!file.existsSync()) file.createSync(recursive: true);
+    file.writeAsStringSync(generated);
+    if (format) {
+      _dartFormat(file.path);
+    }
+  }
+
   /// Generates [file] with symbol output yaml.
   void generateSymbolOutputFile(File file, String importPath) {
     if (!file.existsSync()) file.createSync(recursive: true);
@@ -152,6 +189,39 @@ class Library {
     file.writeAsStringSync(yamlString);
   }
 
+  /// The functions which have a batch shim, see [generateBatchCSource].
+  Iterable<Func> get batchedFunctions => bindings
+      .whereType<Func>()
+      .where((f) => f.batchShimSource != null);
+
+  /// Generates the C source of the batch shims of [batchedFunctions].
+  ///
+  /// It has to be compiled into the same dynamic library as the functions, so
+  /// that the shims can be looked up by the bindings.
+  String generateBatchCSource() {
+    final s = StringBuffer();
+    s.write('''
+// AUTO GENERATED FILE, DO NOT EDIT.
+//
+// Generated by `package:ffigen`.
+// Batch shims, which call a function once for each element of their argument
+// arrays.
+
+#include <stddef.h>
+#include <stdint.h>
+''');
+    for (final f in batchedFunctions) {
+      s.write('\n${f.batchShimSource}');
+    }
+    return s.toString();
+  }
+
+  /// Generates [file] with the C source of the batch shims.
+  void generateBatchCSourceFile(File file) {
+    if (!file.existsSync()) file.createSync(recursive: true);
+    file.writeAsStringSync(generateBatchCSource());
+  }
+
   /// Formats a file using the Dart formatter.
   void _dartFormat(String path) {
     final sdkPath = getSdkPath();
@@ -169,6 +239,12 @@ class Library {
     return writer.generate();
   }
 
+  /// Generates the bindings on [jobs] isolates. The result is the same as
+  /// that of [generate].
+  Future<String> generateInParallel({required int jobs}) {
+    return writer.generateInParallel(jobs);
+  }
+
   @override
   bool operator ==(other) => other is Library && other.generate() == generate();
 
@@ -56,6 +56,9 @@ class NativeType extends Type {
   @override
   String getFfiDartType(Writer w) => _dartType;
 
+  /// True if this is represented by an `int` in Dart.
+  bool get isInteger => _dartType == 'int';
+
   @override
   bool get sameFfiDartAndCType => _cType == _dartType;
 
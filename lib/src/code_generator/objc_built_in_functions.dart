@@ -9,6 +9,12 @@ import 'writer.dart';
 
 /// Built in functions used by the Objective C bindings.
 class ObjCBuiltInFunctions {
+  /// If true, the `autoreleaseScope` method is generated, inside which ObjC
+  /// objects returned by methods are borrowed instead of owned.
+  final bool borrowedViews;
+
+  ObjCBuiltInFunctions({this.borrowedViews = false});
+
   late final _registerNameFunc = Func(
     name: '_sel_registerName',
     originalName: 'sel_registerName',
@@ -16,18 +22,6 @@ class ObjCBuiltInFunctions {
     parameters: [Parameter(name: 'str', type: PointerType(charType))],
     isInternal: true,
   );
-  late final registerName = ObjCInternalFunction(
-      '_registerName', _registerNameFunc, (Writer w, String name) {
-    final selType = _registerNameFunc.functionType.returnType.getCType(w);
-    return '''
-$selType $name(String name) {
-  final cstr = name.toNativeUtf8();
-  final sel = ${_registerNameFunc.name}(cstr.cast());
-  ${w.ffiPkgLibraryPrefix}.calloc.free(cstr);
-  return sel;
-}
-''';
-  });
 
   late final _getClassFunc = Func(
     name: '_objc_getClass',
@@ -36,21 +30,6 @@ $selType $name(String name) {
     parameters: [Parameter(name: 'str', type: PointerType(charType))],
     isInternal: true,
   );
-  late final getClass =
-      ObjCInternalFunction('_getClass', _getClassFunc, (Writer w, String name) {
-    final objType = _getClassFunc.functionType.returnType.getCType(w);
-    return '''
-$objType $name(String name) {
-  final cstr = name.toNativeUtf8();
-  final clazz = ${_getClassFunc.name}(cstr.cast());
-  ${w.ffiPkgLibraryPrefix}.calloc.free(cstr);
-  if (clazz == ${w.ffiLibraryPrefix}.nullptr) {
-    throw Exception('Failed to load Objective-C class: \$name');
-  }
-  return clazz;
-}
-''';
-  });
 
   late final _retainFunc = Func(
     name: '_objc_retain',
@@ -94,6 +73,60 @@ $objType $name(String name) {
     _blockReleaseFunc,
   );
 
+  late final _autoreleasePoolPushFunc = Func(
+    name: '_objc_autoreleasePoolPush',
+    originalName: 'objc_autoreleasePoolPush',
+    returnType: PointerType(voidType),
+    isInternal: true,
+  );
+  late final _autoreleasePoolPopFunc = Func(
+    name: '_objc_autoreleasePoolPop',
+    originalName: 'objc_autoreleasePoolPop',
+    returnType: voidType,
+    parameters: [Parameter(name: 'pool', type: PointerType(voidType))],
+    isInternal: true,
+  );
+
+  // For each open autorelease scope, the index into _scopeReleases where its
+  // deferred releases start.
+  late final _scopes = ObjCInternalGlobal(
+    '_objc_scopes',
+    (Writer w) => '<int>[]',
+  );
+  late final _scopeReleases = ObjCInternalGlobal(
+    '_objc_scopeReleases',
+    (Writer w) => '<${PointerType(objCObjectType).getCType(w)}>[]',
+  );
+  late final autoreleaseScope = ObjCInternalFunction(
+      'autoreleaseScope', _autoreleasePoolPopFunc, (Writer w, String name) {
+    final pool = PointerType(voidType).getCType(w);
+    return '''
+/// Runs [body] inside an ObjC autorelease pool, and returns its result.
+///
+/// ObjC objects returned by methods called inside [body] are borrowed: they
+/// aren't retained or attached to a finalizer, and references owned by the
+/// caller are released in one batch when [body] returns. Borrowed objects must
+/// not be used after the scope ends. Use `castFrom` to get an owned wrapper
+/// for an object that has to outlive the scope.
+T $name<T>(T Function() body) {
+  final $pool pool = ${_autoreleasePoolPushFunc.name}();
+  final start = ${_scopeReleases.name}.length;
+  ${_scopes.name}.add(start);
+  try {
+    return body();
+  } finally {
+    ${_scopes.name}.removeLast();
+    for (var i = ${_scopeReleases.name}.length - 1; i >= start; i--) {
+      ${_releaseFunc.name}(${_scopeReleases.name}[i]);
+    }
+    ${_scopeReleases.name}.length = start;
+    ${_autoreleasePoolPopFunc.name}(pool);
+  }
+}
+
+''';
+  });
+
   // We need to load a separate instance of objc_msgSend for each signature. If
   // the return type is a struct, we need to use objc_msgSend_stret instead, and
   // for float return types we need objc_msgSend_fpret.
@@ -108,14 +141,13 @@ $objType $name(String name) {
         '_objc_msgSend_${_msgSendFuncs.length}', returnType, params);
   }
 
-  final _selObjects = <String, ObjCInternalGlobal>{};
-  ObjCInternalGlobal getSelObject(String methodName) {
-    return _selObjects[methodName] ??= ObjCInternalGlobal(
-      '_sel_${methodName.replaceAll(":", "_")}',
-      (Writer w) => '${registerName.name}("$methodName")',
-      registerName,
-    );
-  }
+  // All the selectors and classes are stored in a single table, which can
+  // resolve them lazily or all at once.
+  late final runtimeTable = ObjCRuntimeTable(this);
+  ObjCRuntimeTableEntry getSelObject(String methodName) =>
+      runtimeTable.getSelector(methodName);
+  ObjCRuntimeTableEntry getClassObject(String lookupName, String name) =>
+      runtimeTable.getClass(lookupName, name);
 
   // See https://clang.llvm.org/docs/Block-ABI-Apple.html
   late final blockStruct = Struct(
@@ -199,7 +231,22 @@ $blockPtr $name($voidPtr invoke, $voidPtr target) {
       String idType,
       String retain,
       String release,
-      String finalizer) {
+      String finalizer,
+      {bool borrowable = false}) {
+    final borrowParam = borrowable ? ', bool borrow = true' : '';
+    final borrowCheck = !borrowable
+        ? ''
+        : '''
+    if (borrow && release && _lib.${_scopes.name}.isNotEmpty) {
+      // Inside an autorelease scope, the reference is only borrowed. An owned
+      // reference is released when the scope ends.
+      _pendingRelease = false;
+      if (!retain) {
+        _lib.${_scopeReleases.name}.add(_id);
+      }
+      return;
+    }
+''';
     s.write('''
 class $name implements ${w.ffiLibraryPrefix}.Finalizable {
   final $idType _id;
@@ -207,8 +254,8 @@ class $name implements ${w.ffiLibraryPrefix}.Finalizable {
   bool _pendingRelease;
 
   $name._(this._id, this._lib,
-      {bool retain = false, bool release = false}) : _pendingRelease = release {
-    if (retain) {
+      {bool retain = false, bool release = false$borrowParam}) : _pendingRelease = release {
+$borrowCheck    if (retain) {
       _lib.$retain(_id.cast());
     }
     if (release) {
@@ -260,7 +307,8 @@ class $name implements ${w.ffiLibraryPrefix}.Finalizable {
         PointerType(objCObjectType).getCType(w),
         _retainFunc.name,
         _releaseFunc.name,
-        _releaseFinalizer.name);
+        _releaseFinalizer.name,
+        borrowable: borrowedViews);
   }
 
   bool blockUtilsExist = false;
@@ -279,16 +327,18 @@ class $name implements ${w.ffiLibraryPrefix}.Finalizable {
   }
 
   void addDependencies(Set<Binding> dependencies) {
-    registerName.addDependencies(dependencies);
-    getClass.addDependencies(dependencies);
     _retainFunc.addDependencies(dependencies);
     _releaseFunc.addDependencies(dependencies);
     _releaseFinalizer.addDependencies(dependencies);
     for (final msgSendFunc in _msgSendFuncs.values) {
       msgSendFunc.func.addDependencies(dependencies);
     }
-    for (final sel in _selObjects.values) {
-      sel.addDependencies(dependencies);
+    runtimeTable.addDependencies(dependencies);
+    if (borrowedViews) {
+      _autoreleasePoolPushFunc.addDependencies(dependencies);
+      _scopes.addDependencies(dependencies);
+      _scopeReleases.addDependencies(dependencies);
+      autoreleaseScope.addDependencies(dependencies);
     }
   }
 
@@ -348,7 +398,7 @@ extension StringToNSString on String {
 }
 
 /// Functions only used internally by ObjC bindings, which may or may not wrap a
-/// native function, such as getClass.
+/// native function, such as newBlock.
 class ObjCInternalFunction extends LookUpBinding {
   final Func? _wrappedFunction;
   final String Function(Writer, String) _toBindingString;
@@ -372,7 +422,170 @@ class ObjCInternalFunction extends LookUpBinding {
   }
 }
 
-/// Globals only used internally by ObjC bindings, such as classes and SELs.
+/// A selector or class stored in an [ObjCRuntimeTable].
+class ObjCRuntimeTableEntry {
+  final ObjCRuntimeTable table;
+  final int index;
+
+  /// The selector, or the name the class is looked up with.
+  final String value;
+
+  /// Name of the getter returning this entry, set when the table is written.
+  String name;
+
+  ObjCRuntimeTableEntry(this.table, this.index, this.value, this.name);
+
+  void addDependencies(Set<Binding> dependencies) {
+    table.addDependencies(dependencies);
+  }
+}
+
+/// Holds all the selectors and classes used by the ObjC bindings.
+///
+/// Each entry is resolved lazily the first time it's used, or all at once by
+/// the generated prefetch method, which passes all the names to native code in
+/// a single allocation.
+class ObjCRuntimeTable extends LookUpBinding {
+  final ObjCBuiltInFunctions _builtInFunctions;
+  final _selectors = <String, ObjCRuntimeTableEntry>{};
+  final _classes = <String, ObjCRuntimeTableEntry>{};
+
+  ObjCRuntimeTable(this._builtInFunctions)
+      : super(
+            originalName: '_objc_runtimeTable',
+            name: '_objc_runtimeTable',
+            isInternal: true);
+
+  ObjCRuntimeTableEntry getSelector(String methodName) {
+    return _selectors[methodName] ??= ObjCRuntimeTableEntry(
+      this,
+      _selectors.length,
+      methodName,
+      '_sel_${methodName.replaceAll(":", "_")}',
+    );
+  }
+
+  /// [name] is the name of the interface, used to name the getter.
+  ObjCRuntimeTableEntry getClass(String lookupName, String name) {
+    return _classes[lookupName] ??= ObjCRuntimeTableEntry(
+        this, _classes.length, lookupName, '_class_$name');
+  }
+
+  @override
+  BindingString toBindingString(Writer w) {
+    final s = StringBuffer();
+    final namer = w.wrapperLevelUniqueNamer;
+    final ffiPrefix = w.ffiLibraryPrefix;
+    final pkgFfiPrefix = w.ffiPkgLibraryPrefix;
+    final selType = PointerType(objCSelType).getCType(w);
+    final objType = PointerType(objCObjectType).getCType(w);
+    final registerName = _builtInFunctions._registerNameFunc.name;
+    final getClass = _builtInFunctions._getClassFunc.name;
+
+    final selectorNames = namer.makeUnique('_objc_selectorNames');
+    final selectors = namer.makeUnique('_objc_selectors');
+    final selector = namer.makeUnique('_objc_selector');
+    final classNames = namer.makeUnique('_objc_classNames');
+    final classes = namer.makeUnique('_objc_classes');
+    final clazz = namer.makeUnique('_objc_class');
+    final prefetch = namer.makeUnique('prefetchObjCRuntime');
+
+    void writeNames(String names, String cache, String type,
+        Iterable<ObjCRuntimeTableEntry> entries) {
+      s.write('static const $names = <String>[\n');
+      for (final e in entries) {
+        s.write('  "${e.value}",\n');
+      }
+      s.write('];\n\n');
+      s.write('late final $cache = List<$type?>.filled($names.length, null);'
+          '\n\n');
+    }
+
+    void writeGetters(
+        String getter, String type, Iterable<ObjCRuntimeTableEntry> entries) {
+      for (final e in entries) {
+        e.name = namer.makeUnique(e.name);
+        s.write('$type get ${e.name} => $getter(${e.index});\n');
+      }
+      s.write('\n');
+    }
+
+    writeNames(selectorNames, selectors, selType, _selectors.values);
+    s.write('''
+$selType $selector(int index) {
+  var sel = $selectors[index];
+  if (sel == null) {
+    final cstr = $selectorNames[index].toNativeUtf8();
+    sel = $selectors[index] = $registerName(cstr.cast());
+    $pkgFfiPrefix.calloc.free(cstr);
+  }
+  return sel;
+}
+
+''');
+    writeGetters(selector, selType, _selectors.values);
+
+    writeNames(classNames, classes, objType, _classes.values);
+    s.write('''
+$objType $clazz(int index) {
+  var cls = $classes[index];
+  if (cls == null) {
+    final cstr = $classNames[index].toNativeUtf8();
+    cls = $getClass(cstr.cast());
+    $pkgFfiPrefix.calloc.free(cstr);
+    if (cls == $ffiPrefix.nullptr) {
+      throw Exception(
+          'Failed to load Objective-C class: \${$classNames[index]}');
+    }
+    $classes[index] = cls;
+  }
+  return cls;
+}
+
+''');
+    writeGetters(clazz, objType, _classes.values);
+
+    s.write('''
+/// Resolves all the ObjC selectors and classes used by these bindings.
+///
+/// They are otherwise resolved lazily, the first time they're used. Calling
+/// this at startup moves that work off latency sensitive code paths. Classes
+/// that fail to load are skipped, and throw when they're first used.
+void $prefetch() {
+  final block = [...$selectorNames, ...$classNames]
+      .join('\\u0000')
+      .toNativeUtf8();
+  var name = block;
+  for (var i = 0; i < $selectors.length; ++i) {
+    $selectors[i] ??= $registerName(name.cast());
+    name = name.cast<$ffiPrefix.Uint8>().elementAt(name.length + 1).cast();
+  }
+  for (var i = 0; i < $classes.length; ++i) {
+    if ($classes[i] == null) {
+      final cls = $getClass(name.cast());
+      if (cls != $ffiPrefix.nullptr) {
+        $classes[i] = cls;
+      }
+    }
+    name = name.cast<$ffiPrefix.Uint8>().elementAt(name.length + 1).cast();
+  }
+  $pkgFfiPrefix.calloc.free(block);
+}
+
+''');
+    return BindingString(type: BindingStringType.global, string: s.toString());
+  }
+
+  @override
+  void addDependencies(Set<Binding> dependencies) {
+    if (dependencies.contains(this)) return;
+    dependencies.add(this);
+    _builtInFunctions._registerNameFunc.addDependencies(dependencies);
+    _builtInFunctions._getClassFunc.addDependencies(dependencies);
+  }
+}
+
+/// Globals only used internally by ObjC bindings, such as finalizers.
 class ObjCInternalGlobal extends LookUpBinding {
   final String Function(Writer) makeValue;
   Binding? binding;
@@ -41,10 +41,15 @@ class ObjCInterface extends BindingType {
   final methods = <String, ObjCMethod>{};
   bool filled = false;
 
+  /// Stubs are interfaces that are only generated because they're a
+  /// dependency. Only their super type is parsed, so they support casting and
+  /// memory management, but have no methods.
+  bool isStub;
+
   final String lookupName;
   final ObjCBuiltInFunctions builtInFunctions;
-  late final ObjCInternalGlobal _classObject;
-  late final ObjCInternalGlobal _isKindOfClass;
+  late final ObjCRuntimeTableEntry _classObject;
+  late final ObjCRuntimeTableEntry _isKindOfClass;
   late final ObjCMsgSendFunc _isKindOfClassMsgSend;
 
   ObjCInterface({
@@ -54,6 +59,7 @@ class ObjCInterface extends BindingType {
     String? lookupName,
     super.dartDoc,
     required this.builtInFunctions,
+    this.isStub = false,
   })  : lookupName = lookupName ?? originalName,
         super(
           name: name ?? originalName,
@@ -89,22 +95,27 @@ class ObjCInterface extends BindingType {
     builtInFunctions.ensureUtilsExist(w, s);
     final objType = PointerType(objCObjectType).getCType(w);
 
-    // Class declaration.
+    // Class declaration. With borrowed views, wrappers created inside an
+    // autorelease scope are borrowed, unless they are created by a cast.
+    final borrowedViews = builtInFunctions.borrowedViews;
+    final borrowParam = borrowedViews ? ', bool borrow = true' : '';
+    final borrowArg = borrowedViews ? ', borrow: borrow' : '';
+    final ownedArg = borrowedViews ? ', borrow: false' : '';
     s.write('''
 class $name extends ${superType?.name ?? '_ObjCWrapper'} {
   $name._($objType id, $natLib lib,
-      {bool retain = false, bool release = false}) :
-          super._(id, lib, retain: retain, release: release);
+      {bool retain = false, bool release = false$borrowParam}) :
+          super._(id, lib, retain: retain, release: release$borrowArg);
 
   /// Returns a [$name] that points to the same underlying object as [other].
   static $name castFrom<T extends _ObjCWrapper>(T other) {
-    return $name._(other._id, other._lib, retain: true, release: true);
+    return $name._(other._id, other._lib, retain: true, release: true$ownedArg);
   }
 
   /// Returns a [$name] that wraps the given raw object pointer.
   static $name castFromPointer($natLib lib, $objType other,
       {bool retain = false, bool release = false}) {
-    return $name._(other, lib, retain: retain, release: release);
+    return $name._(other, lib, retain: retain, release: release$ownedArg);
   }
 
   /// Returns whether [obj] is an instance of [$name].
@@ -242,10 +253,7 @@ class $name extends ${superType?.name ?? '_ObjCWrapper'} {
     dependencies.add(this);
     builtInFunctions.addDependencies(dependencies);
 
-    _classObject = ObjCInternalGlobal(
-        '_class_$originalName',
-        (Writer w) => '${builtInFunctions.getClass.name}("$lookupName")',
-        builtInFunctions.getClass)
+    _classObject = builtInFunctions.getClassObject(lookupName, originalName)
       ..addDependencies(dependencies);
     _isKindOfClass = builtInFunctions.getSelObject('isKindOfClass:');
     _isKindOfClassMsgSend = builtInFunctions.getMsgSendFunc(
@@ -261,8 +269,10 @@ class $name extends ${superType?.name ?? '_ObjCWrapper'} {
 
     if (superType != null) {
       superType!.addDependencies(dependencies);
-      _copyMethodsFromSuperType();
-      _fixNullabilityOfOverriddenMethods();
+      if (!isStub) {
+        _copyMethodsFromSuperType();
+        _fixNullabilityOfOverriddenMethods();
+      }
     }
 
     for (final m in methods.values) {
@@ -478,7 +488,7 @@ class ObjCMethod {
   final ObjCMethodKind kind;
   final bool isClass;
   bool returnsRetained = false;
-  ObjCInternalGlobal? selObject;
+  ObjCRuntimeTableEntry? selObject;
   ObjCMsgSendFunc? msgSend;
 
   ObjCMethod({
@@ -10,13 +10,19 @@ import 'writer.dart';
 class PointerType extends Type {
   final Type child;
 
-  PointerType._(this.child);
+  /// Whether the pointee is const qualified, such as in `const char *`.
+  ///
+  /// This doesn't change the generated type, but tells wrappers that the
+  /// pointee is only read.
+  final bool isConst;
 
-  factory PointerType(Type child) {
+  PointerType._(this.child, {this.isConst = false});
+
+  factory PointerType(Type child, {bool isConst = false}) {
     if (child == objCObjectType) {
       return ObjCObjectPointer();
     }
-    return PointerType._(child);
+    return PointerType._(child, isConst: isConst);
   }
 
   @override
@@ -38,5 +38,9 @@ class Struct extends Compound {
     super.dartDoc,
     super.members,
     super.isInternal,
+    super.size,
+    super.alignment,
+    super.generateLayoutTable,
+    super.generateOffsetAccessors,
   }) : super(compoundType: CompoundType.struct);
 }
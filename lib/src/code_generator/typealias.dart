@@ -17,6 +17,12 @@ import 'writer.dart';
 /// ```
 class Typealias extends BindingType {
   final Type type;
+
+  /// Names of the Dart aliases before name conflicts are resolved.
+  final String? _declaredFfiDartAliasName;
+  final String? _declaredDartAliasName;
+
+  /// Names of the Dart aliases, set by [resolveRenderNames].
   String? _ffiDartAliasName;
   String? _dartAliasName;
 
@@ -73,14 +79,17 @@ class Typealias extends BindingType {
     required this.type,
     bool genFfiDartType = false,
     super.isInternal,
-  })  : _ffiDartAliasName = genFfiDartType ? 'Dart$name' : null,
-        _dartAliasName =
+  })  : _declaredFfiDartAliasName = genFfiDartType ? 'Dart$name' : null,
+        _declaredDartAliasName =
             (!genFfiDartType && type is! Typealias && !type.sameDartAndCType)
                 ? 'Dart$name'
                 : null,
         super(
           name: genFfiDartType ? 'Native$name' : name,
-        );
+        ) {
+    _ffiDartAliasName = _declaredFfiDartAliasName;
+    _dartAliasName = _declaredDartAliasName;
+  }
 
   @override
   void addDependencies(Set<Binding> dependencies) {
@@ -98,14 +107,21 @@ class Typealias extends BindingType {
   }
 
   @override
-  BindingString toBindingString(Writer w) {
-    if (_ffiDartAliasName != null) {
-      _ffiDartAliasName = w.topLevelUniqueNamer.makeUnique(_ffiDartAliasName!);
+  void resolveRenderNames(Writer w) {
+    // Bindings referring to this typedef read the alias names, so they are
+    // resolved before any binding is written.
+    if (_declaredFfiDartAliasName != null) {
+      _ffiDartAliasName =
+          w.topLevelUniqueNamer.makeUnique(_declaredFfiDartAliasName!);
     }
-    if (_dartAliasName != null) {
-      _dartAliasName = w.topLevelUniqueNamer.makeUnique(_dartAliasName!);
+    if (_declaredDartAliasName != null) {
+      _dartAliasName =
+          w.topLevelUniqueNamer.makeUnique(_declaredDartAliasName!);
     }
+  }
 
+  @override
+  BindingString toBindingString(Writer w) {
     final sb = StringBuffer();
     if (dartDoc != null) {
       sb.write(makeDartDoc(dartDoc!));
@@ -36,5 +36,9 @@ class Union extends Compound {
     super.pack,
     super.dartDoc,
     super.members,
+    super.size,
+    super.alignment,
+    super.generateLayoutTable,
+    super.generateOffsetAccessors,
   }) : super(compoundType: CompoundType.union);
 }
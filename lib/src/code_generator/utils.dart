@@ -52,6 +52,94 @@ class UniqueNamer {
   UniqueNamer clone() => UniqueNamer._raw({..._usedUpNames});
 }
 
+/// Names which a binding gave to its parts, such as its parameters, to
+/// resolve the conflicts between them.
+///
+/// Every time the names are resolved, they start again from the declared
+/// names, so that a name made unique by an earlier pass of the writer doesn't
+/// leak into the next one.
+class ResolvedNames<T extends Object> {
+  final _names = <T, (String declared, String resolved)>{};
+
+  /// Returns the declared name of [part], whose name is now [name].
+  ///
+  /// If [name] was changed since it was resolved, it's the new declared name.
+  String declared(T part, String name) {
+    final names = _names[part];
+    return names != null && names.$2 == name ? names.$1 : name;
+  }
+
+  /// Saves that the [declared] name of [part] was resolved to [resolved].
+  void save(T part, String declared, String resolved) {
+    _names[part] = (declared, resolved);
+  }
+}
+
+/// An operation on a [UniqueNamer], recorded by [RecordingUniqueNamer].
+enum UniqueNamerOperation { makeUnique, makeUniqueUnused, markUsed, isUsed }
+
+/// A [UniqueNamer] which records the operations done on it, so that they can
+/// be checked against another namer using [replayOn].
+class RecordingUniqueNamer extends UniqueNamer {
+  final log = <(UniqueNamerOperation, String name, String result)>[];
+
+  /// Creates a RecordingUniqueNamer starting with the used names of [namer].
+  RecordingUniqueNamer(UniqueNamer namer)
+      : super._raw({...namer._usedUpNames});
+
+  @override
+  String makeUnique(String name, [bool addToUsedUpNames = true]) {
+    final result = super.makeUnique(name, addToUsedUpNames);
+    log.add((
+      addToUsedUpNames
+          ? UniqueNamerOperation.makeUnique
+          : UniqueNamerOperation.makeUniqueUnused,
+      name,
+      result
+    ));
+    return result;
+  }
+
+  @override
+  void markUsed(String name) {
+    super.markUsed(name);
+    log.add((UniqueNamerOperation.markUsed, name, ''));
+  }
+
+  @override
+  bool isUsed(String name) {
+    final result = super.isUsed(name);
+    log.add((UniqueNamerOperation.isUsed, name, result ? 'used' : ''));
+    return result;
+  }
+
+  @override
+  bool isUnique(String name) => !isUsed(name);
+
+  /// Applies the operations in [log] to [namer].
+  ///
+  /// Returns false as soon as a result differs from the recorded one. The code
+  /// which used the recording namer would then have generated something else
+  /// with [namer], and [namer] is left partially updated.
+  static bool replayOn(UniqueNamer namer,
+      List<(UniqueNamerOperation, String name, String result)> log) {
+    for (final (operation, name, result) in log) {
+      switch (operation) {
+        case UniqueNamerOperation.makeUnique:
+        case UniqueNamerOperation.makeUniqueUnused:
+          final addToUsedUpNames =
+              operation == UniqueNamerOperation.makeUnique;
+          if (namer.makeUnique(name, addToUsedUpNames) != result) return false;
+        case UniqueNamerOperation.markUsed:
+          namer.markUsed(name);
+        case UniqueNamerOperation.isUsed:
+          if (namer.isUsed(name) != result.isNotEmpty) return false;
+      }
+    }
+    return true;
+  }
+}
+
 /// Converts [text] to a dart doc comment(`///`).
 ///
 /// Comment is split on new lines only.
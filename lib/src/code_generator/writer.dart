@@ -2,6 +2,9 @@
 // for details. All rights reserved. Use of this source code is governed by a
 // BSD-style license that can be found in the LICENSE file.
 
+import 'dart:isolate';
+import 'dart:math';
+
 import 'package:ffigen/src/code_generator.dart';
 import 'package:ffigen/src/code_generator/utils.dart';
 import 'package:logging/logging.dart';
@@ -57,6 +60,11 @@ class Writer {
     return _ffiPkgLibraryPrefix = import.prefix;
   }
 
+  String get typedDataLibraryPrefix {
+    markImportUsed(typedDataImport);
+    return typedDataImport.prefix;
+  }
+
   final Set<LibraryImport> _usedImports = {};
 
   late String _lookupFuncIdentifier;
@@ -66,6 +74,26 @@ class Writer {
   late String _symbolAddressVariableName;
   late String _symbolAddressLibraryVarName;
 
+  /// If true, a function checking the layouts of compounds is generated.
+  final bool verifyCompoundLayouts;
+  late String _verifyCompoundLayoutsName;
+
+  /// If true, the wrapper class can be created from a table of symbol
+  /// addresses in native memory, which is shared by all isolates.
+  final bool sharedSymbolTable;
+  late String _symbolTableClassName;
+  late String _createSymbolTableName;
+
+  late String _stringScratchClassName;
+  bool _stringScratchUsed = false;
+
+  /// Name of the class managing the scratch arena used by string wrappers.
+  /// The class is only generated if this is accessed.
+  String get stringScratchClassName {
+    _stringScratchUsed = true;
+    return _stringScratchClassName;
+  }
+
   /// Initial namers set after running constructor. Namers are reset to this
   /// initial state everytime [generate] is called.
   late UniqueNamer _initialTopLevelUniqueNamer, _initialWrapperLevelUniqueNamer;
@@ -95,6 +123,8 @@ class Writer {
     Set<LibraryImport>? additionalImports,
     this.classDocComment,
     this.header,
+    this.verifyCompoundLayouts = false,
+    this.sharedSymbolTable = false,
   }) {
     final globalLevelNameSet = noLookUpBindings.map((e) => e.name).toSet();
     final wrapperLevelNameSet = lookUpBindings.map((e) => e.name).toSet();
@@ -151,6 +181,42 @@ class Writer {
       markUsed: [_initialWrapperLevelUniqueNamer],
     );
 
+    /// Resolve name conflict of the string wrappers' scratch arena class.
+    _stringScratchClassName = _resolveNameConflict(
+      name: '_StringScratch',
+      makeUnique: allLevelsUniqueNamer,
+      markUsed: [_initialWrapperLevelUniqueNamer, _initialTopLevelUniqueNamer],
+    );
+
+    /// Resolve name conflict of the compound layout verification function.
+    if (verifyCompoundLayouts) {
+      _verifyCompoundLayoutsName = _resolveNameConflict(
+        name: 'verifyCompoundLayouts',
+        makeUnique: allLevelsUniqueNamer,
+        markUsed: [
+          _initialWrapperLevelUniqueNamer,
+          _initialTopLevelUniqueNamer
+        ],
+      );
+    }
+
+    /// Resolve name conflicts of the shared symbol table identifiers.
+    if (sharedSymbolTable) {
+      _symbolTableClassName = _resolveNameConflict(
+        name: '_SymbolTable',
+        makeUnique: allLevelsUniqueNamer,
+        markUsed: [
+          _initialWrapperLevelUniqueNamer,
+          _initialTopLevelUniqueNamer
+        ],
+      );
+      _createSymbolTableName = _resolveNameConflict(
+        name: 'createSymbolTable',
+        makeUnique: _initialWrapperLevelUniqueNamer,
+        markUsed: [_initialWrapperLevelUniqueNamer],
+      );
+    }
+
     /// Finding a unique prefix for Array Helper Classes and store into
     /// [_arrayHelperClassPrefix].
     final base = 'ArrayHelper';
@@ -188,20 +254,166 @@ class Writer {
     _wrapperLevelUniqueNamer = _initialWrapperLevelUniqueNamer.clone();
   }
 
+  /// Resets the namers and resolves the names of all bindings which are read
+  /// by other bindings, see [Binding.resolveRenderNames].
+  void _prepareBindings() {
+    _resetUniqueNamersNamers();
+    _stringScratchUsed = false;
+    for (final b in [
+      ...lookUpBindings,
+      ...ffiNativeBindings,
+      ...noLookUpBindings,
+    ]) {
+      b.resolveRenderNames(this);
+    }
+  }
+
   void markImportUsed(LibraryImport import) {
     _usedImports.add(import);
   }
 
   /// Writes all bindings to a String.
-  String generate() {
+  String generate() => _generate(_renderBindings);
+
+  /// Writes all bindings to a String, rendering them on [jobs] isolates.
+  ///
+  /// The result is identical to [generate]. Every isolate resolves the names
+  /// of all bindings which are read by other bindings, as [generate] does, and
+  /// then renders a slice of the bindings starting from that state of the
+  /// unique namers. The slices are then merged in order, replaying the names
+  /// they generated on the real namers. A slice whose names would have come
+  /// out differently, because it conflicts with a name generated by an earlier
+  /// slice, is rendered again serially.
+  ///
+  /// ObjC bindings share state with each other while rendering, so libraries
+  /// containing them are always rendered serially.
+  Future<String> generateInParallel(int jobs) async {
+    if (jobs <= 1 || !canRenderInParallel) return generate();
+
+    final lists = [lookUpBindings, ffiNativeBindings, noLookUpBindings];
+    final prefixes = {
+      for (final import in strings.predefinedLibraryImports.values)
+        import.name: import.prefix,
+    };
+    final slices = await Future.wait([
+      for (var job = 0; job < jobs; job++)
+        Isolate.run(() => _renderSlices(lists, job, jobs, prefixes)),
+    ]);
+
+    final rendered = <List<Binding>, List<_RenderedSlice>>{
+      for (var i = 0; i < lists.length; i++)
+        lists[i]: [for (final slice in slices) slice[i]],
+    };
+    return _generate(
+        (bindings) => _mergeRenderedSlices(bindings, rendered[bindings]!));
+  }
+
+  /// Whether the bindings can be rendered with [generateInParallel].
+  bool get canRenderInParallel => ![
+        ...lookUpBindings,
+        ...noLookUpBindings
+      ].any((b) =>
+          b is ObjCInterface ||
+          b is ObjCBlock ||
+          b is ObjCInternalFunction ||
+          b is ObjCInternalGlobal ||
+          b is ObjCRuntimeTable);
+
+  String _renderBindings(List<Binding> bindings, [int start = 0, int? end]) {
+    final s = StringBuffer();
+    for (final b in bindings.sublist(start, end)) {
+      s.write(b.toBindingString(this).string);
+    }
+    return s.toString();
+  }
+
+  /// Runs in a worker isolate on a copy of this writer. Renders the slice
+  /// [job] of [jobs] of each of the [lists].
+  List<_RenderedSlice> _renderSlices(List<List<Binding>> lists, int job,
+      int jobs, Map<String, String> prefixes) {
+    // Globals aren't shared between isolates, so the resolved prefixes of the
+    // predefined imports have to be restored.
+    for (final import in strings.predefinedLibraryImports.values) {
+      import.prefix = prefixes[import.name]!;
+    }
+
+    _prepareBindings();
+    final preparedTopLevelNamer = _topLevelUniqueNamer;
+    final preparedWrapperLevelNamer = _wrapperLevelUniqueNamer;
+
+    final result = <_RenderedSlice>[];
+    for (final bindings in lists) {
+      final sliceSize = (bindings.length / jobs).ceil();
+      final start = min(job * sliceSize, bindings.length);
+      final end = min(start + sliceSize, bindings.length);
+
+      final topLevelNamer = RecordingUniqueNamer(preparedTopLevelNamer);
+      final wrapperLevelNamer = RecordingUniqueNamer(preparedWrapperLevelNamer);
+      _topLevelUniqueNamer = topLevelNamer;
+      _wrapperLevelUniqueNamer = wrapperLevelNamer;
+      _stringScratchUsed = false;
+      final importsBefore = _usedImports.length;
+      final symbolsBefore = symbolAddressWriter._addresses.length;
+
+      final string = _renderBindings(bindings, start, end);
+
+      result.add(_RenderedSlice(
+        start: start,
+        end: end,
+        string: string,
+        topLevelNames: topLevelNamer.log,
+        wrapperLevelNames: wrapperLevelNamer.log,
+        usedImports: _usedImports.skip(importsBefore).toList(),
+        symbolAddresses:
+            symbolAddressWriter._addresses.sublist(symbolsBefore),
+        usesStringScratch: _stringScratchUsed,
+      ));
+    }
+    return result;
+  }
+
+  /// Merges the [slices] of [bindings] rendered by [_renderSlices] in order,
+  /// applying their side effects to this writer.
+  String _mergeRenderedSlices(
+      List<Binding> bindings, List<_RenderedSlice> slices) {
+    final s = StringBuffer();
+    for (final slice in slices) {
+      if (slice.start == slice.end) continue;
+
+      final topLevelNamer = _topLevelUniqueNamer.clone();
+      final wrapperLevelNamer = _wrapperLevelUniqueNamer.clone();
+      if (RecordingUniqueNamer.replayOn(
+              topLevelNamer, slice.topLevelNames) &&
+          RecordingUniqueNamer.replayOn(
+              wrapperLevelNamer, slice.wrapperLevelNames)) {
+        _topLevelUniqueNamer = topLevelNamer;
+        _wrapperLevelUniqueNamer = wrapperLevelNamer;
+        _usedImports.addAll(slice.usedImports);
+        symbolAddressWriter._addresses.addAll(slice.symbolAddresses);
+        _stringScratchUsed |= slice.usesStringScratch;
+        s.write(slice.string);
+      } else {
+        _logger.fine(() =>
+            'Rendering bindings ${slice.start} to ${slice.end} '
+            'again because of a name conflict.');
+        s.write(_renderBindings(bindings, slice.start, slice.end));
+      }
+    }
+    return s.toString();
+  }
+
+  /// Writes all bindings to a String, using [render] to write the bindings of
+  /// each of the binding lists.
+  String _generate(String Function(List<Binding> bindings) render) {
     final s = StringBuffer();
 
     // We write the source first to determine which imports are actually
     // referenced. Headers and [s] are then combined into the final result.
     final result = StringBuffer();
 
-    // Reset unique namers to initial state.
-    _resetUniqueNamersNamers();
+    // Reset unique namers to initial state, and resolve the names which are
+    // read across bindings.
+    _prepareBindings();
 
     // Write file header (if any).
     if (header != null) {
@@ -240,9 +452,10 @@ class Writer {
       // Write wrapper class named constructor.
       s.write(
           '$_className.fromLookup($ffiLibraryPrefix.Pointer<T> Function<T extends $ffiLibraryPrefix.NativeType>(String symbolName) lookup): $lookupFuncIdentifier = lookup;\n\n');
-      for (final b in lookUpBindings) {
-        s.write(b.toBindingString(this).string);
+      if (sharedSymbolTable) {
+        s.write(_writeSymbolTableConstructors());
       }
+      s.write(render(lookUpBindings));
       if (symbolAddressWriter.shouldGenerate) {
         s.write(symbolAddressWriter.writeObject(this));
       }
@@ -250,17 +463,25 @@ class Writer {
       s.write('}\n\n');
     }
 
-    for (final b in ffiNativeBindings) {
-      s.write(b.toBindingString(this).string);
-    }
+    s.write(render(ffiNativeBindings));
 
     if (symbolAddressWriter.shouldGenerate) {
       s.write(symbolAddressWriter.writeClass(this));
     }
 
     /// Write [noLookUpBindings].
-    for (final b in noLookUpBindings) {
-      s.write(b.toBindingString(this).string);
+    s.write(render(noLookUpBindings));
+
+    if (verifyCompoundLayouts) {
+      s.write(_writeCompoundLayoutVerifier());
+    }
+
+    if (_stringScratchUsed) {
+      s.write(_writeStringScratchClass());
+    }
+
+    if (sharedSymbolTable && lookUpBindings.isNotEmpty) {
+      s.write(_writeSymbolTableClass());
     }
 
     // Write neccesary imports.
@@ -275,6 +496,211 @@ class Writer {
     return result.toString();
   }
 
+  /// Writes a function which checks that the sizes of the generated compounds
+  /// match the sizes computed by clang. Must be called after all
+  /// [noLookUpBindings] are written.
+  String _writeCompoundLayoutVerifier() {
+    final compounds =
+        noLookUpBindings.whereType<Compound>().where((c) => c.hasLayoutTable);
+    final s = StringBuffer();
+    s.write(makeDartDoc(
+        'Checks that the sizes of the generated structs and unions match the '
+        'sizes computed by clang when the bindings were generated.\n\n'
+        'Throws a [StateError] on the first mismatch. Returns true, so that it '
+        'can be called as `assert($_verifyCompoundLayoutsName())`.'));
+    s.write('bool $_verifyCompoundLayoutsName() {\n');
+    for (final c in compounds) {
+      final dartSize = '$ffiLibraryPrefix.sizeOf<${c.name}>()';
+      s.write('  if ($dartSize != ${c.name}.${c.sizeOfName}) {\n');
+      s.write("    throw StateError('Size of ${c.name} is \${$dartSize} bytes "
+          "in Dart, but ${c.size} bytes in C.');\n");
+      s.write('  }\n');
+    }
+    s.write('  return true;\n');
+    s.write('}\n\n');
+    return s.toString();
+  }
+
+  /// Names of the symbols looked up by the wrapper class, in the order of the
+  /// shared symbol table.
+  List<String> get _symbolTableNames => {
+        for (final b in lookUpBindings)
+          if (b is Func || b is Global) b.originalName,
+      }.toList();
+
+  /// Writes the members of the wrapper class which create it from a shared
+  /// symbol table.
+  String _writeSymbolTableConstructors() {
+    final ffi = ffiLibraryPrefix;
+    final table = _symbolTableClassName;
+    final tablePtr = '$ffi.Pointer<$ffi.Pointer<$ffi.Void>>';
+    return '''
+/// The symbols are read from [symbolTable], created by [$_createSymbolTableName].
+///
+/// No symbols are looked up, so this is cheap to call in every isolate that
+/// uses the library.
+$_className.fromSymbolTable($tablePtr symbolTable)
+    : $lookupFuncIdentifier = $table(symbolTable).lookup;
+
+/// Looks up all the symbols used by this class in [dynamicLibrary] once, and
+/// stores their addresses in native memory allocated with [allocator].
+///
+/// The table can be sent to other isolates, which create this class with
+/// [$_className.fromSymbolTable]. Symbols missing from [dynamicLibrary] throw
+/// when they're first used.
+static $tablePtr $_createSymbolTableName($ffi.DynamicLibrary dynamicLibrary,
+    {$ffi.Allocator allocator = $ffiPkgLibraryPrefix.malloc}) {
+  final symbolTable =
+      allocator<$ffi.Pointer<$ffi.Void>>($table.symbolNames.length);
+  for (var i = 0; i < $table.symbolNames.length; ++i) {
+    final symbolName = $table.symbolNames[i];
+    symbolTable[i] = dynamicLibrary.providesSymbol(symbolName)
+        ? dynamicLibrary.lookup<$ffi.Void>(symbolName)
+        : $ffi.nullptr;
+  }
+  return symbolTable;
+}
+
+''';
+  }
+
+  /// Writes the class which looks up symbols in a shared symbol table.
+  String _writeSymbolTableClass() {
+    final ffi = ffiLibraryPrefix;
+    final names = _symbolTableNames;
+    final s = StringBuffer();
+    s.write('/// Addresses of the symbols used by [$_className], in native '
+        'memory.\n');
+    s.write('class $_symbolTableClassName {\n');
+    s.write('static const symbolNames = <String>[\n');
+    for (final name in names) {
+      s.write("  '$name',\n");
+    }
+    s.write('];\n\n');
+    s.write('static const _indices = <String, int>{\n');
+    for (var i = 0; i < names.length; i++) {
+      s.write("  '${names[i]}': $i,\n");
+    }
+    s.write('};\n\n');
+    s.write('''
+final $ffi.Pointer<$ffi.Pointer<$ffi.Void>> symbolTable;
+
+$_symbolTableClassName(this.symbolTable);
+
+$ffi.Pointer<T> lookup<T extends $ffi.NativeType>(String symbolName) {
+  final index = _indices[symbolName];
+  final address = index == null ? $ffi.nullptr : symbolTable[index];
+  if (address == $ffi.nullptr) {
+    throw ArgumentError("Failed to lookup symbol '\$symbolName'");
+  }
+  return address.cast<T>();
+}
+}
+
+''');
+    return s.toString();
+  }
+
+  /// Writes the class holding the scratch arena used by string wrappers.
+  ///
+  /// Dart statics are isolate-local, so the arena is never shared between
+  /// threads. Calls take a [mark] before encoding their arguments and release
+  /// back to it afterwards, which keeps nested calls from callbacks correct.
+  String _writeStringScratchClass() {
+    final ffi = ffiLibraryPrefix;
+    final pkgFfi = ffiPkgLibraryPrefix;
+    final name = _stringScratchClassName;
+    return '''
+/// Reusable native memory for passing Dart strings to C.
+///
+/// Strings are encoded into an arena which lives as long as the isolate, so
+/// short strings don't need a malloc/free pair per call. Strings which don't
+/// fit are allocated separately and freed when the call returns.
+class $name {
+  $name._();
+
+  static const int _capacity = 4096;
+  static $ffi.Pointer<$ffi.Uint8> _arena = $ffi.nullptr;
+  static int _used = 0;
+  static final List<$ffi.Pointer<$ffi.Uint8>> _overflow = [];
+
+  /// Length in bytes of the last string encoded by [toNative], excluding the
+  /// NUL terminator.
+  static int lastLength = 0;
+
+  /// The current state of the arena, to be passed to [release].
+  static int get mark => (_overflow.length << 32) | _used;
+
+  /// Releases everything encoded since [mark] was read.
+  static void release(int mark) {
+    _used = mark & 0xFFFFFFFF;
+    final overflow = mark >> 32;
+    while (_overflow.length > overflow) {
+      $pkgFfi.malloc.free(_overflow.removeLast());
+    }
+  }
+
+  /// Encodes [s] as a NUL terminated UTF-8 string, valid until [release].
+  static $ffi.Pointer<$ffi.Uint8> toNative(String s) {
+    // Each UTF-16 code unit takes at most 3 bytes in UTF-8.
+    final maxBytes = s.length * 3 + 1;
+    final $ffi.Pointer<$ffi.Uint8> out;
+    final inArena = _used + maxBytes <= _capacity;
+    if (inArena) {
+      if (_arena == $ffi.nullptr) {
+        _arena = $pkgFfi.malloc<$ffi.Uint8>(_capacity);
+      }
+      out = $ffi.Pointer.fromAddress(_arena.address + _used);
+    } else {
+      out = $pkgFfi.malloc<$ffi.Uint8>(maxBytes);
+      _overflow.add(out);
+    }
+    var j = 0;
+    for (var i = 0; i < s.length; i++) {
+      var c = s.codeUnitAt(i);
+      if (c < 0x80) {
+        out[j++] = c;
+      } else if (c < 0x800) {
+        out[j++] = 0xC0 | (c >> 6);
+        out[j++] = 0x80 | (c & 0x3F);
+      } else if ((c & 0xFC00) == 0xD800 &&
+          i + 1 < s.length &&
+          (s.codeUnitAt(i + 1) & 0xFC00) == 0xDC00) {
+        c = 0x10000 + ((c & 0x3FF) << 10) + (s.codeUnitAt(++i) & 0x3FF);
+        out[j++] = 0xF0 | (c >> 18);
+        out[j++] = 0x80 | ((c >> 12) & 0x3F);
+        out[j++] = 0x80 | ((c >> 6) & 0x3F);
+        out[j++] = 0x80 | (c & 0x3F);
+      } else {
+        // Unpaired surrogates are replaced with U+FFFD.
+        if ((c & 0xF800) == 0xD800) c = 0xFFFD;
+        out[j++] = 0xE0 | (c >> 12);
+        out[j++] = 0x80 | ((c >> 6) & 0x3F);
+        out[j++] = 0x80 | (c & 0x3F);
+      }
+    }
+    out[j] = 0;
+    lastLength = j;
+    if (inArena) _used += j + 1;
+    return out;
+  }
+
+  /// Decodes the UTF-8 string at [p] without copying it to a temporary
+  /// buffer, reading at most [maxLength] bytes if given.
+  static String? fromNative($ffi.Pointer<$ffi.Char> p, [int? maxLength]) {
+    if (p == $ffi.nullptr) return null;
+    final bytes = p.cast<$ffi.Uint8>();
+    var length = 0;
+    while ((maxLength == null || length < maxLength) && bytes[length] != 0) {
+      length++;
+    }
+    return p.cast<$pkgFfi.Utf8>().toDartString(length: length);
+  }
+}
+
+''';
+  }
+
   Map<String, dynamic> generateSymbolOutputYamlMap(String importFilePath) {
     final bindings = <Binding>[
       ...noLookUpBindings,
@@ -358,6 +784,29 @@ class SymbolAddressWriter {
   }
 }
 
+/// The output of rendering a slice of a binding list in a worker isolate, and
+/// the side effects it had on the writer.
+class _RenderedSlice {
+  final int start, end;
+  final String string;
+  final List<(UniqueNamerOperation, String, String)> topLevelNames;
+  final List<(UniqueNamerOperation, String, String)> wrapperLevelNames;
+  final List<LibraryImport> usedImports;
+  final List<_SymbolAddressUnit> symbolAddresses;
+  final bool usesStringScratch;
+
+  _RenderedSlice({
+    required this.start,
+    required this.end,
+    required this.string,
+    required this.topLevelNames,
+    required this.wrapperLevelNames,
+    required this.usedImports,
+    required this.symbolAddresses,
+    required this.usesStringScratch,
+  });
+}
+
 /// Holds the data for a single symbol address.
 class _SymbolAddressUnit {
   final String type, name, ptrName;
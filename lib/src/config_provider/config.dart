@@ -29,8 +29,11 @@ class Config {
   final PackageConfig? packageConfig;
 
   /// Location for llvm/lib folder.
-  String get libclangDylib => _libclangDylib;
-  late String _libclangDylib;
+  ///
+  /// The default locations are only searched when this is first used, so that
+  /// generating code from a declaration IR doesn't need libclang.
+  String get libclangDylib => _libclangDylib ??= findDylibAtDefaultLocations();
+  String? _libclangDylib;
 
   /// Output file name.
   String get output => _output;
@@ -40,6 +43,14 @@ class Config {
   SymbolFile? get symbolFile => _symbolFile;
   late SymbolFile? _symbolFile;
 
+  /// Path to write the declaration IR to, if any.
+  String? get irOutput => _irOutput;
+  late String? _irOutput;
+
+  /// Path to write the C source of the batch shims to, if any.
+  String? get batchCSource => _batchCSource;
+  late String? _batchCSource;
+
   /// Language that ffigen is consuming.
   Language get language => _language;
   late Language _language;
@@ -52,6 +63,11 @@ class Config {
   List<String> get compilerOpts => _compilerOpts;
   late List<String> _compilerOpts;
 
+  /// Directory containing the `compile_commands.json` with the per header
+  /// compiler options, if any.
+  String? get compilationDatabase => _compilationDatabase;
+  String? _compilationDatabase;
+
   /// VarArg function handling.
   Map<String, List<VarArgFunction>> get varArgFunctions => _varArgFunctions;
   late Map<String, List<VarArgFunction>> _varArgFunctions = {};
@@ -72,6 +88,10 @@ class Config {
   Declaration get enumClassDecl => _enumClassDecl;
   late Declaration _enumClassDecl;
 
+  /// Enums generated as Dart enums with a `fromValue` lookup.
+  Includer get enumsAsDartEnums => _enumsAsDartEnums;
+  late Includer _enumsAsDartEnums;
+
   /// Declaration config for Unnamed enum constants.
   Declaration get unnamedEnumConstants => _unnamedEnumConstants;
   late Declaration _unnamedEnumConstants;
@@ -146,6 +166,15 @@ class Config {
   StructPackingOverride get structPackingOverride => _structPackingOverride;
   late StructPackingOverride _structPackingOverride;
 
+  /// Whether ObjC interfaces that are dependencies should be fully parsed.
+  CompoundDependencies get objcInterfaceDependencies =>
+      _objcInterfaceDependencies;
+  late CompoundDependencies _objcInterfaceDependencies;
+
+  /// Whether ObjC objects returned inside an autorelease scope are borrowed.
+  bool get objcBorrowedViews => _objcBorrowedViews;
+  late bool _objcBorrowedViews;
+
   /// Module prefixes for ObjC interfaces.
   ObjCModulePrefixer get objcModulePrefixer => _objcModulePrefixer;
   late ObjCModulePrefixer _objcModulePrefixer;
@@ -172,9 +201,42 @@ class Config {
   Includer get leafFunctions => _leafFunctions;
   late Includer _leafFunctions;
 
+  /// Functions which get a wrapper taking Dart strings for `char*` params.
+  Includer get stringWrapperFunctions => _stringWrapperFunctions;
+  late Includer _stringWrapperFunctions;
+
+  /// Functions whose string wrappers also pass the encoded length in the
+  /// integer parameter following a `char*` parameter.
+  Includer get stringLengthArguments => _stringLengthArguments;
+  late Includer _stringLengthArguments;
+
+  /// Functions which get a C shim calling them for whole arrays at once.
+  Includer get batchWrapperFunctions => _batchWrapperFunctions;
+  late Includer _batchWrapperFunctions;
+
   FfiNativeConfig get ffiNativeConfig => _ffiNativeConfig;
   late FfiNativeConfig _ffiNativeConfig;
 
+  /// If the wrapper class can be created from a table of symbol addresses
+  /// shared by all isolates.
+  bool get sharedSymbolTable => _sharedSymbolTable;
+  late bool _sharedSymbolTable;
+
+  /// Opaque structs which get a handle class releasing them with a native
+  /// finalizer, keyed by their original name.
+  Map<String, FinalizableHandleConfig> get finalizableHandles =>
+      _finalizableHandles;
+  late Map<String, FinalizableHandleConfig> _finalizableHandles;
+
+  /// Options for code generated from the layouts of structs and unions.
+  CompoundLayout get compoundLayout => _compoundLayout;
+  late CompoundLayout _compoundLayout;
+
+  /// If set, only the declarations in the manifest and their dependencies are
+  /// generated.
+  UsageManifest? get usageManifest => _usageManifest;
+  UsageManifest? _usageManifest;
+
   Config._({required this.filename, required this.packageConfig});
 
   /// Create config from Yaml map.
@@ -228,8 +290,7 @@ class Config {
             childConfigSpec: StringConfigSpec(),
             transform: (node) => llvmPathExtractor(node.value),
           ),
-          defaultValue: (node) => findDylibAtDefaultLocations(),
-          resultOrDefault: (node) => _libclangDylib = node.value as String,
+          result: (node) => _libclangDylib = node.value as String,
         ),
         HeterogeneousMapEntry(
             key: strings.output,
@@ -244,6 +305,8 @@ class Config {
               result: (node) {
                 _output = (node.value as OutputConfig).output;
                 _symbolFile = (node.value as OutputConfig).symbolFile;
+                _irOutput = (node.value as OutputConfig).ir;
+                _batchCSource = (node.value as OutputConfig).batchCSource;
               },
             )),
         HeterogeneousMapEntry(
@@ -323,6 +386,16 @@ class Config {
               result: (node) => _compilerOpts.addAll(
                   (node.value as CompilerOptsAuto).extractCompilerOpts()),
             )),
+        HeterogeneousMapEntry(
+          key: strings.compilationDatabase,
+          valueConfigSpec: StringConfigSpec(
+            schemaDefName: 'filePath',
+            schemaDescription: "A file path",
+            transform: (node) =>
+                compilationDatabaseExtractor(node.value, filename),
+            result: (node) => _compilationDatabase = node.value as String,
+          ),
+        ),
         HeterogeneousMapEntry(
           key: strings.libraryImports,
           valueConfigSpec: MapConfigSpec<String, Map<String, LibraryImport>>(
@@ -358,6 +431,21 @@ class Config {
                   valueConfigSpec: _includeExcludeObject(),
                   defaultValue: (node) => Includer.excludeByDefault(),
                 ),
+                HeterogeneousMapEntry(
+                  key: strings.stringWrappers,
+                  valueConfigSpec: _includeExcludeObject(),
+                  defaultValue: (node) => Includer.excludeByDefault(),
+                ),
+                HeterogeneousMapEntry(
+                  key: strings.stringLengthArguments,
+                  valueConfigSpec: _includeExcludeObject(),
+                  defaultValue: (node) => Includer.excludeByDefault(),
+                ),
+                HeterogeneousMapEntry(
+                  key: strings.batchWrappers,
+                  valueConfigSpec: _includeExcludeObject(),
+                  defaultValue: (node) => Includer.excludeByDefault(),
+                ),
                 HeterogeneousMapEntry(
                   key: strings.varArgFunctions,
                   valueConfigSpec: _functionVarArgsConfigSpec(),
@@ -376,6 +464,12 @@ class Config {
                     as Map)[strings.exposeFunctionTypedefs] as Includer;
                 _leafFunctions =
                     (node.value as Map)[strings.leafFunctions] as Includer;
+                _stringWrapperFunctions =
+                    (node.value as Map)[strings.stringWrappers] as Includer;
+                _stringLengthArguments = (node.value
+                    as Map)[strings.stringLengthArguments] as Includer;
+                _batchWrapperFunctions =
+                    (node.value as Map)[strings.batchWrappers] as Includer;
               },
             )),
         HeterogeneousMapEntry(
@@ -437,10 +531,17 @@ class Config {
                 ..._includeExcludeProperties(),
                 ..._renameProperties(),
                 ..._memberRenameProperties(),
+                HeterogeneousMapEntry(
+                  key: strings.enumsAsDartEnums,
+                  valueConfigSpec: _includeExcludeObject(),
+                  defaultValue: (node) => Includer.excludeByDefault(),
+                ),
               ],
               result: (node) {
                 _enumClassDecl = declarationConfigExtractor(
                     node.value as Map<dynamic, dynamic>);
+                _enumsAsDartEnums =
+                    (node.value as Map)[strings.enumsAsDartEnums] as Includer;
               },
             )),
         HeterogeneousMapEntry(
@@ -507,13 +608,23 @@ class Config {
                   key: strings.objcModule,
                   valueConfigSpec: _objcInterfaceModuleObject(),
                   defaultValue: (node) => ObjCModulePrefixer({}),
-                )
+                ),
+                _dependencyOnlyHeterogeneousMapKey(),
+                HeterogeneousMapEntry(
+                  key: strings.objcBorrowedViews,
+                  valueConfigSpec: BoolConfigSpec(),
+                  defaultValue: (node) => false,
+                ),
               ],
               result: (node) {
                 _objcInterfaces = declarationConfigExtractor(
                     node.value as Map<dynamic, dynamic>);
                 _objcModulePrefixer = (node.value as Map)[strings.objcModule]
                     as ObjCModulePrefixer;
+                _objcInterfaceDependencies = (node.value
+                    as Map)[strings.dependencyOnly] as CompoundDependencies;
+                _objcBorrowedViews =
+                    (node.value as Map)[strings.objcBorrowedViews] as bool;
               },
             )),
         HeterogeneousMapEntry(
@@ -659,6 +770,93 @@ class Config {
           resultOrDefault: (node) =>
               _ffiNativeConfig = (node.value) as FfiNativeConfig,
         ),
+        HeterogeneousMapEntry(
+          key: strings.sharedSymbolTable,
+          valueConfigSpec: BoolConfigSpec(),
+          defaultValue: (node) => false,
+          resultOrDefault: (node) {
+            _sharedSymbolTable = node.value as bool;
+            if (_sharedSymbolTable && _language == Language.objc) {
+              _logger.severe('${strings.sharedSymbolTable} is not supported '
+                  'for Objective C bindings, ignoring it.');
+              _sharedSymbolTable = false;
+            }
+          },
+        ),
+        HeterogeneousMapEntry(
+          key: strings.finalizableHandles,
+          valueConfigSpec:
+              MapConfigSpec<FinalizableHandleConfig, Map<dynamic, dynamic>>(
+            keyValueConfigSpecs: [
+              (
+                keyRegexp: ".*",
+                valueConfigSpec: HeterogeneousMapConfigSpec(
+                  entries: [
+                    HeterogeneousMapEntry(
+                      key: strings.finalizableHandleDestructor,
+                      valueConfigSpec: StringConfigSpec(),
+                      required: true,
+                    ),
+                    HeterogeneousMapEntry(
+                      key: strings.finalizableHandleSize,
+                      valueConfigSpec: StringConfigSpec(),
+                    ),
+                  ],
+                  transform: (node) => finalizableHandleExtractor(node.value),
+                ),
+              ),
+            ],
+          ),
+          defaultValue: (node) => <dynamic, dynamic>{},
+          resultOrDefault: (node) => _finalizableHandles = {
+            for (final MapEntry(:key, :value) in (node.value as Map).entries)
+              key.toString(): value as FinalizableHandleConfig,
+          },
+        ),
+        HeterogeneousMapEntry(
+          key: strings.compoundLayout,
+          valueConfigSpec: HeterogeneousMapConfigSpec(
+            entries: [
+              HeterogeneousMapEntry(
+                key: strings.compoundLayoutTables,
+                valueConfigSpec: BoolConfigSpec(),
+                defaultValue: (node) => false,
+              ),
+              HeterogeneousMapEntry(
+                key: strings.compoundLayoutVerify,
+                valueConfigSpec: BoolConfigSpec(),
+                defaultValue: (node) => false,
+              ),
+              HeterogeneousMapEntry(
+                key: strings.compoundLayoutOffsetAccessors,
+                valueConfigSpec: _includeExcludeObject(),
+                defaultValue: (node) => Includer.excludeByDefault(),
+              ),
+            ],
+            transform: (node) => compoundLayoutExtractor(node.value),
+          ),
+          resultOrDefault: (node) =>
+              _compoundLayout = node.value as CompoundLayout,
+        ),
+        HeterogeneousMapEntry(
+          key: strings.usageManifest,
+          valueConfigSpec: HeterogeneousMapConfigSpec(
+            entries: [
+              HeterogeneousMapEntry(
+                key: strings.usageManifestFiles,
+                valueConfigSpec: ListConfigSpec<String, List<String>>(
+                    childConfigSpec: StringConfigSpec()),
+              ),
+              HeterogeneousMapEntry(
+                key: strings.usageManifestDartSources,
+                valueConfigSpec: ListConfigSpec<String, List<String>>(
+                    childConfigSpec: StringConfigSpec()),
+              ),
+            ],
+            transform: (node) => usageManifestExtractor(node.value, filename),
+            result: (node) => _usageManifest = node.value as UsageManifest,
+          ),
+        ),
       ],
     );
   }
@@ -773,6 +971,14 @@ class Config {
             ],
           ),
         ),
+        HeterogeneousMapEntry(
+          key: strings.ir,
+          valueConfigSpec: _filePathStringConfigSpec(),
+        ),
+        HeterogeneousMapEntry(
+          key: strings.batchCSource,
+          valueConfigSpec: _filePathStringConfigSpec(),
+        ),
       ],
     );
   }
@@ -389,6 +389,49 @@ class FfiNativeConfig {
   const FfiNativeConfig({required this.enabled, this.assetId});
 }
 
+/// Native functions managing the lifetime of an opaque struct.
+class FinalizableHandleConfig {
+  /// Original name of the function releasing the struct.
+  final String destructor;
+
+  /// Original name of a function returning the native memory owned by the
+  /// struct, in bytes.
+  final String? size;
+
+  const FinalizableHandleConfig({required this.destructor, this.size});
+}
+
+/// Options for generating code from the struct/union layouts computed by clang.
+class CompoundLayout {
+  /// Generate size, alignment and member offset constants on compounds.
+  final bool tables;
+
+  /// Generate a function which checks the Dart layouts against the tables.
+  final bool verify;
+
+  /// Compounds for which offset based accessors are generated.
+  final Includer offsetAccessors;
+
+  CompoundLayout({
+    this.tables = false,
+    this.verify = false,
+    Includer? offsetAccessors,
+  }) : offsetAccessors = offsetAccessors ?? Includer.excludeByDefault();
+}
+
+/// Names of the declarations which are used, all other declarations are only
+/// generated if they are a dependency of a used declaration.
+class UsageManifest {
+  final Set<String> names;
+
+  UsageManifest(this.names);
+
+  /// True if a declaration is used under its [originalName] or generated
+  /// [name].
+  bool isUsed(String originalName, String name) =>
+      names.contains(originalName) || names.contains(name);
+}
+
 class SymbolFile {
   final String importPath;
   final String output;
@@ -400,7 +443,13 @@ class OutputConfig {
   final String output;
   final SymbolFile? symbolFile;
 
-  OutputConfig(this.output, this.symbolFile);
+  /// Path of the declaration IR file, if any.
+  final String? ir;
+
+  /// Path of the C source with the batch shims, if any.
+  final String? batchCSource;
+
+  OutputConfig(this.output, this.symbolFile, this.ir, this.batchCSource);
 }
 
 class RawVarArgFunction {
@@ -39,6 +39,15 @@ String _normalizePath(String path, String? configFilename) {
       skipNormalization ? path : p.join(p.dirname(configFilename), path));
 }
 
+/// Returns the directory of a compilation database, given either the directory
+/// or the path to its `compile_commands.json`.
+String compilationDatabaseExtractor(String path, String? configFilename) {
+  final normalized = _normalizePath(path, configFilename);
+  return p.basename(normalized) == 'compile_commands.json'
+      ? p.dirname(normalized)
+      : normalized;
+}
+
 Map<String, LibraryImport> libraryImportsExtractor(
     Map<String, String>? typeMap) {
   final resultMap = <String, LibraryImport>{};
@@ -414,7 +423,8 @@ String llvmPathExtractor(List<String> value) {
 OutputConfig outputExtractor(
     dynamic value, String? configFilename, PackageConfig? packageConfig) {
   if (value is String) {
-    return OutputConfig(_normalizePath(value, configFilename), null);
+    return OutputConfig(
+        _normalizePath(value, configFilename), null, null, null);
   }
   value = value as Map;
   return OutputConfig(
@@ -423,6 +433,12 @@ OutputConfig outputExtractor(
         ? symbolFileOutputExtractor(
             value[strings.symbolFile], configFilename, packageConfig)
         : null,
+    value.containsKey(strings.ir)
+        ? _normalizePath(value[strings.ir] as String, configFilename)
+        : null,
+    value.containsKey(strings.batchCSource)
+        ? _normalizePath(value[strings.batchCSource] as String, configFilename)
+        : null,
   );
 }
 
@@ -598,6 +614,63 @@ StructPackingOverride structPackingOverrideExtractor(
   return StructPackingOverride(matcherMap: matcherMap);
 }
 
+CompoundLayout compoundLayoutExtractor(Map<dynamic, dynamic> yamlMap) {
+  final verify = yamlMap[strings.compoundLayoutVerify] as bool;
+  return CompoundLayout(
+    // The verification function reads the generated tables.
+    tables: verify || yamlMap[strings.compoundLayoutTables] as bool,
+    verify: verify,
+    offsetAccessors:
+        yamlMap[strings.compoundLayoutOffsetAccessors] as Includer,
+  );
+}
+
+UsageManifest usageManifestExtractor(
+    Map<dynamic, dynamic> yamlMap, String? configFilename) {
+  final names = <String>{};
+  final files = yamlMap[strings.usageManifestFiles] as List<String>? ?? [];
+  for (final f in files) {
+    final path = _normalizePath(f, configFilename);
+    _logger.fine('Reading usage manifest: $path');
+    for (var line in File(path).readAsLinesSync()) {
+      final commentStart = line.indexOf('#');
+      if (commentStart != -1) line = line.substring(0, commentStart);
+      line = line.trim();
+      if (line.isNotEmpty) names.add(line);
+    }
+  }
+
+  // Every identifier in the Dart sources is considered used. This over
+  // approximates the used declarations, but never misses one.
+  final identifier = RegExp(r'[A-Za-z_$][A-Za-z0-9_$]*');
+  final sources =
+      yamlMap[strings.usageManifestDartSources] as List<String>? ?? [];
+  for (final s in sources) {
+    final sourceGlob = _normalizePath(s, configFilename);
+    final paths = File(sourceGlob).existsSync()
+        ? [sourceGlob]
+        : Glob(sourceGlob)
+            .listFileSystemSync(const LocalFileSystem(), followLinks: true)
+            .whereType<File>()
+            .map((f) => f.path);
+    for (final path in paths) {
+      _logger.fine('Scanning Dart source for usages: $path');
+      names.addAll(identifier
+          .allMatches(File(path).readAsStringSync())
+          .map((m) => m[0]!));
+    }
+  }
+  return UsageManifest(names);
+}
+
+FinalizableHandleConfig finalizableHandleExtractor(
+    Map<dynamic, dynamic> yamlMap) {
+  return FinalizableHandleConfig(
+    destructor: yamlMap[strings.finalizableHandleDestructor] as String,
+    size: yamlMap[strings.finalizableHandleSize] as String?,
+  );
+}
+
 FfiNativeConfig ffiNativeExtractor(dynamic yamlConfig) {
   final yamlMap = yamlConfig as Map?;
   return FfiNativeConfig(
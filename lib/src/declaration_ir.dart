@@ -0,0 +1,64 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+/// Reads and writes the declarations found by the header_parser as a JSON
+/// file, so that code can be generated from them without parsing any headers.
+///
+/// The file has the following format:
+///
+/// ```json
+/// {
+///   "format_version": "1.0.0",
+///   "bindings": [0, 2],
+///   "declarations": [
+///     {
+///       "kind": "struct",
+///       "usr": "c:@S@Point",
+///       "originalName": "Point",
+///       "name": "Point",
+///       "dartDoc": "A point.",
+///       "location": {"file": "/path/to/point.h", "line": 2, "column": 8},
+///       "isIncomplete": false,
+///       "size": 8,
+///       "alignment": 4,
+///       "members": [
+///         {"originalName": "x", "name": "x", "offsetInBits": 0,
+///          "type": {"kind": "imported", "library": "ffi",
+///                   "importPath": "dart:ffi", "cType": "Int",
+///                   "dartType": "int", "defaultValue": "0"}},
+///         ...
+///       ]
+///     },
+///     {"kind": "typealias", "name": "PointPtr", ...,
+///      "type": {"kind": "pointer",
+///               "child": {"kind": "declaration", "id": 0}}},
+///     {"kind": "function", "name": "move", ...,
+///      "returnType": {...}, "parameters": [...]}
+///   ]
+/// }
+/// ```
+///
+/// `bindings` lists the declarations returned by the parser, in order. Every
+/// other declaration is only a dependency of these. Structs, unions, enums and
+/// typedefs are referred to from types by their index in `declarations`,
+/// which allows recursive types. The declaration kinds are `function`,
+/// `struct`, `union`, `enum`, `typealias`, `global` and `constant`. The type
+/// kinds are `declaration`, `native`, `bool`, `pointer`, `constantArray`,
+/// `incompleteArray`, `nativeFunction`, `function`, `imported`,
+/// `selfImported`, `handle` and `unimplemented`.
+///
+/// The declarations are written after the config has been applied, so names
+/// are already renamed and excluded declarations are missing. Options which
+/// only affect the generated code, such as `functions -> leaf`, `ffi-native`
+/// or `enums -> as-dart-enums`, are not part of the IR and are applied from
+/// the config when it's read, so that the same file can be used with different
+/// options. Objective C declarations are not supported yet.
+///
+/// The major version of `format_version` changes whenever a file can't be read
+/// by an older version of ffigen.
+library declaration_ir;
+
+export 'declaration_ir/ir_reader.dart';
+export 'declaration_ir/ir_writer.dart';
+export 'declaration_ir/source_location.dart';
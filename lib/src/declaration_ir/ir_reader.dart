@@ -0,0 +1,357 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/config_provider.dart';
+import 'package:ffigen/src/strings.dart' as strings;
+import 'package:logging/logging.dart';
+
+import 'source_location.dart';
+
+final _logger = Logger('ffigen.declaration_ir.ir_reader');
+
+/// Reads the bindings from a declaration IR file, see [bindingsFromIr].
+List<Binding> readIrFile(File file, Config config,
+    {DependencyGraph? dependencyGraph}) {
+  final ir = jsonDecode(file.readAsStringSync()) as Map<String, dynamic>;
+  final formatVersion = ir[strings.formatVersion] as String;
+  if (formatVersion.split('.')[0] != strings.irFormatVersion.split('.')[0]) {
+    _logger.severe('Incompatible format versions for file ${file.path}: '
+        '${strings.irFormatVersion}(ours), $formatVersion(theirs).');
+    exit(1);
+  }
+  return bindingsFromIr(ir, config, dependencyGraph: dependencyGraph);
+}
+
+/// Creates the bindings written by [bindingsToIr], in the same order.
+///
+/// The bindings can be used to build a [Library] without parsing any headers.
+/// The code generation options of [config], such as `functions -> leaf` or
+/// `ffi-native`, are applied to the declarations as they're read, in the same
+/// way as the header parser does. Imported types use the matching library
+/// imports of [config], so that their prefixes are resolved together with the
+/// library.
+///
+/// If [dependencyGraph] is given, the declarations read replace the ones it
+/// holds, and those which changed since it was last updated are marked dirty.
+List<Binding> bindingsFromIr(Map<String, dynamic> ir, Config config,
+    {DependencyGraph? dependencyGraph}) {
+  final reader = _IrReader(ir[strings.irDeclarations] as List, config);
+  final bindings = <Binding>[];
+  for (final id in ir[strings.bindings] as List) {
+    final b = reader.declaration(id as int);
+    if (b is Global && config.ffiNativeConfig.enabled) {
+      _logger.warning(
+          "Skipped global variable '${b.originalName}', not supported in "
+          'Natives.');
+      continue;
+    }
+    bindings.add(b);
+  }
+  reader.readPendingMembers();
+  dependencyGraph?.updateDeclarations({
+    for (final b in reader._bindings.values) b.usr: b,
+  }, {
+    for (final e in reader._bindings.entries)
+      e.value.usr: reader.fingerprint(e.key),
+  });
+  return bindings;
+}
+
+/// Returns the locations of all declarations in [ir] which have one, keyed by
+/// USR.
+Map<String, SourceLocation> locationsFromIr(Map<String, dynamic> ir) => {
+      for (final d in ir[strings.irDeclarations] as List)
+        if (d['location'] != null)
+          d['usr'] as String: SourceLocation.fromJson(
+              (d['location'] as Map).cast<String, dynamic>()),
+    };
+
+/// Predefined imported types, so that comparisons against them still work.
+final _predefinedImportedTypes = {
+  for (final t in [
+    voidType,
+    unsignedCharType,
+    signedCharType,
+    charType,
+    unsignedShortType,
+    shortType,
+    unsignedIntType,
+    intType,
+    unsignedLongType,
+    longType,
+    unsignedLongLongType,
+    longLongType,
+    floatType,
+    doubleType,
+    sizeType,
+    wCharType,
+  ])
+    t.cType: t,
+};
+
+class _IrReader {
+  final List declarations;
+  final Config config;
+  final _bindings = <int, Binding>{};
+  final Map<String, LibraryImport> _libraryImports;
+
+  /// Compounds are created before their members are read, so that recursive
+  /// types refer to the same instance.
+  final _pendingCompounds = <int, Compound>{};
+
+  _IrReader(this.declarations, this.config)
+      : _libraryImports = {
+          ...strings.predefinedLibraryImports,
+          ...config.libraryImports,
+        };
+
+  Binding declaration(int id) {
+    return _bindings[id] ??=
+        _readDeclaration(id, declarations[id] as Map<String, dynamic>);
+  }
+
+  void readPendingMembers() {
+    while (_pendingCompounds.isNotEmpty) {
+      final id = _pendingCompounds.keys.first;
+      final compound = _pendingCompounds.remove(id)!;
+      final members = <Member>[];
+      for (final m in declarations[id]['members'] as List) {
+        final storage = m['bitFieldStorage'] as int?;
+        members.add(Member(
+          originalName: m['originalName'] as String,
+          name: m['name'] as String,
+          type: _readType(m['type'] as Map<String, dynamic>),
+          dartDoc: m['dartDoc'] as String?,
+          offsetInBits: m['offsetInBits'] as int?,
+          bitWidth: m['bitWidth'] as int?,
+          isSignedBitField: m['isSignedBitField'] as bool? ?? false,
+          // Storage units are always placed before their bit fields.
+          bitFieldStorage: storage == null ? null : members[storage],
+        ));
+      }
+      compound.members = members;
+      compound.parsedDependencies = true;
+    }
+  }
+
+  /// Returns a string which changes whenever the declaration [id] or the
+  /// options applied to it change.
+  ///
+  /// Declarations referenced by [id] are identified by their USR, as their
+  /// ids change when declarations are added to or removed from the IR.
+  String fingerprint(int id) {
+    Object? withUsrs(Object? json) {
+      if (json is Map) {
+        if (json['kind'] == 'declaration' && json['id'] is int) {
+          return {'declaration': declarations[json['id'] as int]['usr']};
+        }
+        return {
+          for (final e in json.entries)
+            if (e.key != 'location') e.key: withUsrs(e.value),
+        };
+      }
+      if (json is List) return [for (final e in json) withUsrs(e)];
+      return json;
+    }
+
+    final b = _bindings[id]!;
+    return jsonEncode([
+      withUsrs(declarations[id]),
+      if (b is Func) ...[
+        b.exposeSymbolAddress,
+        b.exposeFunctionTypedefs,
+        b.isLeaf,
+        b.ffiNativeConfig.enabled,
+        b.ffiNativeConfig.assetId,
+        b.stringWrapper,
+        b.stringLengthArguments,
+        b.batchWrapper,
+      ],
+      if (b is Compound) ...[
+        b.generateLayoutTable,
+        b.generateOffsetAccessors,
+      ],
+      if (b is EnumClass) b.generateAsDartEnum,
+      if (b is Global) b.exposeSymbolAddress,
+    ]);
+  }
+
+  Binding _readDeclaration(int id, Map<String, dynamic> d) {
+    final usr = d['usr'] as String;
+    final originalName = d['originalName'] as String;
+    final name = d['name'] as String;
+    final dartDoc = d['dartDoc'] as String?;
+    final isInternal = d['isInternal'] as bool? ?? false;
+    switch (d['kind']) {
+      case 'function':
+        final returnType = _readType(d['returnType'] as Map<String, dynamic>);
+        final parameters = _readParameters(d['parameters'] as List);
+        final varArgParameters =
+            _readParameters(d['varArgParameters'] as List?);
+        var batchWrapper =
+            config.batchWrapperFunctions.shouldInclude(originalName);
+        if (batchWrapper &&
+            !canBatch(
+                FunctionType(returnType: returnType, parameters: parameters))) {
+          _logger.warning(
+              "Skipping batch wrapper for function '$originalName', only "
+              'functions taking numbers and returning a number or void can be '
+              'batched.');
+          batchWrapper = false;
+        }
+        return Func(
+          usr: usr,
+          originalName: originalName,
+          name: name,
+          dartDoc: dartDoc,
+          isInternal: isInternal,
+          returnType: returnType,
+          parameters: parameters,
+          varArgParameters: varArgParameters,
+          exposeSymbolAddress:
+              config.functionDecl.shouldIncludeSymbolAddress(originalName),
+          exposeFunctionTypedefs:
+              config.exposeFunctionTypedefs.shouldInclude(originalName),
+          isLeaf: config.leafFunctions.shouldInclude(originalName),
+          ffiNativeConfig: config.ffiNativeConfig,
+          stringWrapper:
+              config.stringWrapperFunctions.shouldInclude(originalName),
+          stringLengthArguments:
+              config.stringLengthArguments.shouldInclude(originalName),
+          batchWrapper: batchWrapper && varArgParameters.isEmpty,
+        );
+      case 'struct':
+      case 'union':
+        final compound = Compound.fromType(
+          type:
+              d['kind'] == 'struct' ? CompoundType.struct : CompoundType.union,
+          usr: usr,
+          originalName: originalName,
+          name: name,
+          dartDoc: dartDoc,
+          isIncomplete: d['isIncomplete'] as bool,
+          pack: d['pack'] as int?,
+          generateLayoutTable: config.compoundLayout.tables,
+          generateOffsetAccessors:
+              config.compoundLayout.offsetAccessors.shouldInclude(originalName),
+        )
+          ..size = d['size'] as int?
+          ..alignment = d['alignment'] as int?;
+        _pendingCompounds[id] = compound;
+        return compound;
+      case 'enum':
+        return EnumClass(
+          usr: usr,
+          originalName: originalName,
+          name: name,
+          dartDoc: dartDoc,
+          enumConstants: [
+            for (final c in d['enumConstants'] as List)
+              EnumConstant(
+                originalName: c['originalName'] as String,
+                name: c['name'] as String,
+                value: c['value'] as int,
+                dartDoc: c['dartDoc'] as String?,
+              )
+          ],
+          generateAsDartEnum:
+              config.enumsAsDartEnums.shouldInclude(originalName),
+        );
+      case 'typealias':
+        return Typealias(
+          usr: usr,
+          originalName: originalName,
+          name: name,
+          dartDoc: dartDoc,
+          isInternal: isInternal,
+          type: _readType(d['type'] as Map<String, dynamic>),
+        );
+      case 'global':
+        return Global(
+          usr: usr,
+          originalName: originalName,
+          name: name,
+          dartDoc: dartDoc,
+          type: _readType(d['type'] as Map<String, dynamic>),
+          exposeSymbolAddress:
+              config.functionDecl.shouldIncludeSymbolAddress(originalName),
+        );
+      case 'constant':
+        return Constant(
+          usr: usr,
+          originalName: originalName,
+          name: name,
+          dartDoc: dartDoc,
+          rawType: d['rawType'] as String,
+          rawValue: d['rawValue'] as String,
+        );
+    }
+    throw FormatException('Unknown declaration kind: ${d['kind']}');
+  }
+
+  List<Parameter> _readParameters(List? parameters) => [
+        for (final p in parameters ?? const [])
+          Parameter(
+            originalName: p['originalName'] as String?,
+            name: p['name'] as String,
+            type: _readType(p['type'] as Map<String, dynamic>),
+          )
+      ];
+
+  FunctionType _readFunctionType(Map<String, dynamic> t) => FunctionType(
+        returnType: _readType(t['returnType'] as Map<String, dynamic>),
+        parameters: _readParameters(t['parameters'] as List),
+        varArgParameters: _readParameters(t['varArgParameters'] as List?),
+      );
+
+  Type _readType(Map<String, dynamic> t) {
+    Type child() => _readType(t['child'] as Map<String, dynamic>);
+    switch (t['kind']) {
+      case 'declaration':
+        return declaration(t['id'] as int) as Type;
+      case 'bool':
+        return BooleanType();
+      case 'native':
+        return NativeType(
+            SupportedNativeType.values.byName(t['type'] as String));
+      case 'constantArray':
+        return ConstantArray(t['length'] as int, child());
+      case 'incompleteArray':
+        return IncompleteArray(child());
+      case 'pointer':
+        final isConst = t['isConst'] as bool? ?? false;
+        return PointerType(child(), isConst: isConst);
+      case 'nativeFunction':
+        return NativeFunc(_readType(t['function'] as Map<String, dynamic>));
+      case 'function':
+        return _readFunctionType(t);
+      case 'imported':
+        final library = t['library'] as String;
+        final cType = t['cType'] as String;
+        if (library == ffiImport.name &&
+            _predefinedImportedTypes.containsKey(cType)) {
+          return _predefinedImportedTypes[cType]!;
+        }
+        return ImportedType(
+          _libraryImports[library] ??=
+              LibraryImport(library, t['importPath'] as String),
+          cType,
+          t['dartType'] as String,
+          t['defaultValue'] as String?,
+        );
+      case 'selfImported':
+        return SelfImportedType(t['cType'] as String, t['dartType'] as String,
+            t['defaultValue'] as String?);
+      case 'handle':
+        return HandleType();
+      case 'unimplemented':
+        return UnimplementedType(t['reason'] as String);
+    }
+    throw FormatException('Unknown type kind: ${t['kind']}');
+  }
+}
@@ -0,0 +1,196 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/strings.dart' as strings;
+
+import 'source_location.dart';
+
+/// Writes [bindings] as a declaration IR file, see [bindingsToIr].
+void writeIrFile(File file, List<Binding> bindings,
+    {Map<String, SourceLocation> locations = const {}}) {
+  if (!file.existsSync()) file.createSync(recursive: true);
+  file.writeAsStringSync(const JsonEncoder.withIndent('  ')
+      .convert(bindingsToIr(bindings, locations: locations)));
+}
+
+/// Converts [bindings], as returned by the header parser, to the declaration
+/// IR.
+///
+/// [locations] maps the USR of a declaration to where it was declared.
+Map<String, dynamic> bindingsToIr(List<Binding> bindings,
+    {Map<String, SourceLocation> locations = const {}}) {
+  final writer = _IrWriter(locations);
+  final ids = [for (final b in bindings) writer.declarationId(b)];
+  return {
+    strings.formatVersion: strings.irFormatVersion,
+    strings.bindings: ids,
+    strings.irDeclarations: writer.declarations,
+  };
+}
+
+class _IrWriter {
+  final Map<String, SourceLocation> locations;
+
+  /// Declarations are referred to by their index in this list.
+  final declarations = <Map<String, dynamic>>[];
+  final _declarationIds = <Binding, int>{};
+
+  _IrWriter(this.locations);
+
+  int declarationId(Binding b) {
+    final seenId = _declarationIds[b];
+    if (seenId != null) return seenId;
+
+    // The id is reserved before the declaration is written, so that recursive
+    // types such as linked list nodes refer back to it.
+    final id = declarations.length;
+    _declarationIds[b] = id;
+    declarations.add(const {});
+    declarations[id] = _writeDeclaration(b);
+    return id;
+  }
+
+  Map<String, dynamic> _writeDeclaration(Binding b) {
+    final json = <String, dynamic>{
+      'kind': _declarationKind(b),
+      'usr': b.usr,
+      'originalName': b.originalName,
+      'name': b.name,
+      if (b.dartDoc != null) 'dartDoc': b.dartDoc,
+      if (b.isInternal) 'isInternal': true,
+      if (locations[b.usr] != null) 'location': locations[b.usr]!.toJson(),
+    };
+    if (b is Func) {
+      json.addAll(_writeFunctionType(b.functionType));
+    } else if (b is Compound) {
+      json.addAll({
+        'isIncomplete': b.isIncomplete,
+        if (b.pack != null) 'pack': b.pack,
+        if (b.size != null) 'size': b.size,
+        if (b.alignment != null) 'alignment': b.alignment,
+        'members': [for (final m in b.members) _writeMember(b, m)],
+      });
+    } else if (b is EnumClass) {
+      json['enumConstants'] = [
+        for (final c in b.enumConstants)
+          {
+            'originalName': c.originalName,
+            'name': c.name,
+            'value': c.value,
+            if (c.dartDoc != null) 'dartDoc': c.dartDoc,
+          }
+      ];
+    } else if (b is Typealias) {
+      json['type'] = _writeType(b.type);
+    } else if (b is Global) {
+      json['type'] = _writeType(b.type);
+    } else if (b is Constant) {
+      json.addAll({'rawType': b.rawType, 'rawValue': b.rawValue});
+    }
+    return json;
+  }
+
+  String _declarationKind(Binding b) {
+    if (b is Func) return 'function';
+    if (b is Struct) return 'struct';
+    if (b is Union) return 'union';
+    if (b is EnumClass) return 'enum';
+    if (b is Typealias && b is! ObjCInstanceType) return 'typealias';
+    if (b is Global) return 'global';
+    if (b is Constant) return 'constant';
+    throw Exception('Declaration ${b.name} (${b.runtimeType}) is not supported '
+        'by the declaration IR.');
+  }
+
+  Map<String, dynamic> _writeMember(Compound c, Member m) => {
+        'originalName': m.originalName,
+        'name': m.name,
+        'type': _writeType(m.type),
+        if (m.dartDoc != null) 'dartDoc': m.dartDoc,
+        if (m.offsetInBits != null) 'offsetInBits': m.offsetInBits,
+        if (m.bitWidth != null) 'bitWidth': m.bitWidth,
+        if (m.isSignedBitField) 'isSignedBitField': true,
+        if (m.bitFieldStorage != null)
+          'bitFieldStorage': c.members.indexOf(m.bitFieldStorage!),
+      };
+
+  Map<String, dynamic> _writeFunctionType(FunctionType t) => {
+        'returnType': _writeType(t.returnType),
+        'parameters': [for (final p in t.parameters) _writeParameter(p)],
+        if (t.varArgParameters.isNotEmpty)
+          'varArgParameters': [
+            for (final p in t.varArgParameters) _writeParameter(p)
+          ],
+      };
+
+  Map<String, dynamic> _writeParameter(Parameter p) => {
+        if (p.originalName != null) 'originalName': p.originalName,
+        'name': p.name,
+        'type': _writeType(p.type),
+      };
+
+  Map<String, dynamic> _writeType(Type t) {
+    if (t is BindingType) {
+      return {'kind': 'declaration', 'id': declarationId(t)};
+    } else if (t is BooleanType) {
+      return {'kind': 'bool'};
+    } else if (t is NativeType) {
+      return {
+        'kind': 'native',
+        'type': SupportedNativeType.values
+            .firstWhere((n) => identical(NativeType(n), t))
+            .name,
+      };
+    } else if (t is ObjCObjectPointer || t is ObjCNullable) {
+      throw Exception('Objective C types are not supported by the '
+          'declaration IR.');
+    } else if (t is ConstantArray) {
+      return {
+        'kind': 'constantArray',
+        'length': t.length,
+        'child': _writeType(t.child),
+      };
+    } else if (t is IncompleteArray) {
+      return {'kind': 'incompleteArray', 'child': _writeType(t.child)};
+    } else if (t is PointerType) {
+      return {
+        'kind': 'pointer',
+        if (t.isConst) 'isConst': true,
+        'child': _writeType(t.child),
+      };
+    } else if (t is NativeFunc) {
+      // A typedef of a function pointer wraps the function type in another
+      // typedef, which is recreated when reading the IR.
+      return {'kind': 'nativeFunction', 'function': _writeType(t.type)};
+    } else if (t is FunctionType) {
+      return {'kind': 'function', ..._writeFunctionType(t)};
+    } else if (t is ImportedType) {
+      return {
+        'kind': 'imported',
+        'library': t.libraryImport.name,
+        'importPath': t.libraryImport.importPath,
+        'cType': t.cType,
+        'dartType': t.dartType,
+        if (t.defaultValue != null) 'defaultValue': t.defaultValue,
+      };
+    } else if (t is SelfImportedType) {
+      return {
+        'kind': 'selfImported',
+        'cType': t.cType,
+        'dartType': t.dartType,
+        if (t.defaultValue != null) 'defaultValue': t.defaultValue,
+      };
+    } else if (t is HandleType) {
+      return {'kind': 'handle'};
+    } else if (t is UnimplementedType) {
+      return {'kind': 'unimplemented', 'reason': t.reason};
+    }
+    throw Exception('Type $t (${t.runtimeType}) is not supported by the '
+        'declaration IR.');
+  }
+}
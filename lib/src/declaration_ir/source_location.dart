@@ -0,0 +1,23 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+/// Location of a declaration in a source file, as reported by clang.
+class SourceLocation {
+  final String file;
+
+  /// 1-based line and column of the declaration.
+  final int line;
+  final int column;
+
+  const SourceLocation(this.file, this.line, this.column);
+
+  Map<String, dynamic> toJson() =>
+      {'file': file, 'line': line, 'column': column};
+
+  factory SourceLocation.fromJson(Map<String, dynamic> json) => SourceLocation(
+      json['file'] as String, json['line'] as int, json['column'] as int);
+
+  @override
+  String toString() => '$file:$line:$column';
+}
@@ -8,6 +8,7 @@ import 'dart:io';
 import 'package:args/args.dart';
 import 'package:cli_util/cli_logging.dart' show Ansi;
 import 'package:ffigen/ffigen.dart';
+import 'package:ffigen/src/strings.dart' as strings;
 import 'package:logging/logging.dart';
 import 'package:package_config/package_config.dart';
 import 'package:yaml/yaml.dart' as yaml;
@@ -17,8 +18,10 @@ final _ansi = Ansi(Ansi.terminalSupportsAnsi);
 
 const compilerOpts = 'compiler-opts';
 const conf = 'config';
+const fromIr = 'from-ir';
 const help = 'help';
 const verbose = 'verbose';
+const watch = 'watch';
 const pubspecName = 'pubspec.yaml';
 const configKey = 'ffigen';
 const logAll = 'all';
@@ -51,12 +54,55 @@ void main(List<String> args) async {
     exit(1);
   }
 
-  // Parse the bindings according to config object provided.
-  final library = parse(config);
+  // Parse the bindings according to config object provided, or read them from
+  // a declaration IR file written by a previous run.
+  final Library library;
+  if (argResult.wasParsed(fromIr)) {
+    final irFile = File(argResult[fromIr] as String);
+    if (!irFile.existsSync()) {
+      _logger.severe('Error: ${irFile.path} not found.');
+      exit(1);
+    }
+    if (argResult[watch] as bool) {
+      await watchIr(config, irFile);
+      return;
+    }
+    library = parseIr(config, irFile);
+  } else {
+    library = parse(config);
+  }
+
+  await generateOutputs(config, library);
+}
+
+/// Generates the bindings from [irFile], and again whenever it's modified.
+///
+/// The dependencies of the declarations are kept between runs, so that only
+/// the declarations which changed are traversed again.
+Future<void> watchIr(Config config, File irFile) async {
+  final dependencyGraph = DependencyGraph();
+  await generateOutputs(
+      config, parseIr(config, irFile, dependencyGraph: dependencyGraph));
+  _logger.info('Watching ${irFile.absolute.path} for changes.');
+  await for (final _ in irFile.watch(events: FileSystemEvent.modify)) {
+    final Library library;
+    try {
+      library = parseIr(config, irFile, dependencyGraph: dependencyGraph);
+    } on FormatException catch (e) {
+      // The file may still be written.
+      _logger.warning('Could not read ${irFile.path}: ${e.message}');
+      continue;
+    }
+    await generateOutputs(config, library);
+  }
+}
 
+/// Writes the bindings of [library], and the symbol file and batch shims if
+/// they're configured.
+Future<void> generateOutputs(Config config, Library library) async {
   // Generate file for the parsed bindings.
   final gen = File(config.output);
-  library.generateFile(gen);
+  await library.generateFileInParallel(gen);
   _logger
       .info(successPen('Finished, Bindings generated in ${gen.absolute.path}'));
 
@@ -67,6 +113,19 @@ void main(List<String> args) async {
     _logger.info(successPen(
         'Finished, Symbol Output generated in ${symbolFileGen.absolute.path}'));
   }
+
+  if (library.batchedFunctions.isNotEmpty) {
+    if (config.batchCSource == null) {
+      _logger.warning('Batch wrappers were generated, but no '
+          '${strings.output} -> ${strings.batchCSource} is set to write their '
+          'C source to.');
+    } else {
+      final batchGen = File(config.batchCSource!);
+      library.generateBatchCSourceFile(batchGen);
+      _logger.info(successPen(
+          'Finished, Batch shims generated in ${batchGen.absolute.path}'));
+    }
+  }
 }
 
 Config getConfig(ArgResults result, PackageConfig? packageConfig) {
@@ -158,6 +217,17 @@ ArgResults getArgResults(List<String> args) {
     compilerOpts,
     help: 'Compiler options for clang. (E.g --$compilerOpts "-I/headers -W")',
   );
+  parser.addOption(
+    fromIr,
+    help: 'Generate the bindings from a declaration IR file written using the '
+        'output -> ir config, without parsing any headers.',
+  );
+  parser.addFlag(
+    watch,
+    help: 'With --$fromIr, generate the bindings again whenever the IR file '
+        'is modified.',
+    negatable: false,
+  );
 
   ArgResults results;
   try {
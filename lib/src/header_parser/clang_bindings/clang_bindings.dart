@@ -611,6 +611,23 @@ class Clang {
   late final _clang_getCanonicalType =
       _clang_getCanonicalTypePtr.asFunction<CXType Function(CXType)>();
 
+  /// Determine whether a CXType has the "const" qualifier set,
+  /// without looking through typedefs that may have added "const" at a
+  /// different level.
+  int clang_isConstQualifiedType(
+    CXType T,
+  ) {
+    return _clang_isConstQualifiedType(
+      T,
+    );
+  }
+
+  late final _clang_isConstQualifiedTypePtr =
+      _lookup<ffi.NativeFunction<ffi.UnsignedInt Function(CXType)>>(
+          'clang_isConstQualifiedType');
+  late final _clang_isConstQualifiedType =
+      _clang_isConstQualifiedTypePtr.asFunction<int Function(CXType)>();
+
   /// Determine whether a  CXCursor that is a macro, is
   /// function like.
   int clang_Cursor_isMacroFunctionLike(
@@ -915,6 +932,27 @@ class Clang {
   late final _clang_Type_getAlignOf =
       _clang_Type_getAlignOfPtr.asFunction<int Function(CXType)>();
 
+  /// Return the size of a type in bytes as per C++[expr.sizeof] standard.
+  ///
+  /// If the type declaration is invalid, CXTypeLayoutError_Invalid is returned.
+  /// If the type declaration is an incomplete type, CXTypeLayoutError_Incomplete
+  /// is returned.
+  /// If the type declaration is a dependent type, CXTypeLayoutError_Dependent is
+  /// returned.
+  int clang_Type_getSizeOf(
+    CXType T,
+  ) {
+    return _clang_Type_getSizeOf(
+      T,
+    );
+  }
+
+  late final _clang_Type_getSizeOfPtr =
+      _lookup<ffi.NativeFunction<ffi.LongLong Function(CXType)>>(
+          'clang_Type_getSizeOf');
+  late final _clang_Type_getSizeOf =
+      _clang_Type_getSizeOfPtr.asFunction<int Function(CXType)>();
+
   /// Return the type that was modified by this attributed type.
   ///
   /// If the type is not an attributed type, an invalid type is returned.
@@ -932,6 +970,31 @@ class Clang {
   late final _clang_Type_getModifiedType =
       _clang_Type_getModifiedTypePtr.asFunction<CXType Function(CXType)>();
 
+  /// Return the offset of the field represented by the Cursor.
+  ///
+  /// If the cursor is not a field declaration, -1 is returned.
+  /// If the cursor semantic parent is not a record field declaration,
+  /// CXTypeLayoutError_Invalid is returned.
+  /// If the field's type declaration is an incomplete type,
+  /// CXTypeLayoutError_Incomplete is returned.
+  /// If the field's type declaration is a dependent type,
+  /// CXTypeLayoutError_Dependent is returned.
+  /// If the field's name S is not found,
+  /// CXTypeLayoutError_InvalidFieldName is returned.
+  int clang_Cursor_getOffsetOfField(
+    CXCursor C,
+  ) {
+    return _clang_Cursor_getOffsetOfField(
+      C,
+    );
+  }
+
+  late final _clang_Cursor_getOffsetOfFieldPtr =
+      _lookup<ffi.NativeFunction<ffi.LongLong Function(CXCursor)>>(
+          'clang_Cursor_getOffsetOfField');
+  late final _clang_Cursor_getOffsetOfField =
+      _clang_Cursor_getOffsetOfFieldPtr.asFunction<int Function(CXCursor)>();
+
   /// Determine whether the given cursor represents an anonymous
   /// tag or namespace
   int clang_Cursor_isAnonymous(
@@ -1352,6 +1415,173 @@ class Clang {
           'clang_EvalResult_dispose');
   late final _clang_EvalResult_dispose =
       _clang_EvalResult_disposePtr.asFunction<void Function(CXEvalResult)>();
+
+  /// Creates a compilation database from the database found in directory
+  /// buildDir. For example, CMake can output a compile_commands.json which can
+  /// be used to build the database.
+  ///
+  /// It must be freed by \c clang_CompilationDatabase_dispose.
+  CXCompilationDatabase clang_CompilationDatabase_fromDirectory(
+    ffi.Pointer<ffi.Char> BuildDir,
+    ffi.Pointer<ffi.Int32> ErrorCode,
+  ) {
+    return _clang_CompilationDatabase_fromDirectory(
+      BuildDir,
+      ErrorCode,
+    );
+  }
+
+  late final _clang_CompilationDatabase_fromDirectoryPtr = _lookup<
+          ffi.NativeFunction<
+              CXCompilationDatabase Function(
+                  ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Int32>)>>(
+      'clang_CompilationDatabase_fromDirectory');
+  late final _clang_CompilationDatabase_fromDirectory =
+      _clang_CompilationDatabase_fromDirectoryPtr.asFunction<
+          CXCompilationDatabase Function(
+              ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Int32>)>();
+
+  /// Free the given compilation database
+  void clang_CompilationDatabase_dispose(
+    CXCompilationDatabase arg0,
+  ) {
+    return _clang_CompilationDatabase_dispose(
+      arg0,
+    );
+  }
+
+  late final _clang_CompilationDatabase_disposePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(CXCompilationDatabase)>>(
+          'clang_CompilationDatabase_dispose');
+  late final _clang_CompilationDatabase_dispose =
+      _clang_CompilationDatabase_disposePtr
+          .asFunction<void Function(CXCompilationDatabase)>();
+
+  /// Find the compile commands used for a file. The compile commands
+  /// must be freed by \c clang_CompileCommands_dispose.
+  CXCompileCommands clang_CompilationDatabase_getCompileCommands(
+    CXCompilationDatabase arg0,
+    ffi.Pointer<ffi.Char> CompleteFileName,
+  ) {
+    return _clang_CompilationDatabase_getCompileCommands(
+      arg0,
+      CompleteFileName,
+    );
+  }
+
+  late final _clang_CompilationDatabase_getCompileCommandsPtr = _lookup<
+          ffi.NativeFunction<
+              CXCompileCommands Function(
+                  CXCompilationDatabase, ffi.Pointer<ffi.Char>)>>(
+      'clang_CompilationDatabase_getCompileCommands');
+  late final _clang_CompilationDatabase_getCompileCommands =
+      _clang_CompilationDatabase_getCompileCommandsPtr.asFunction<
+          CXCompileCommands Function(
+              CXCompilationDatabase, ffi.Pointer<ffi.Char>)>();
+
+  /// Free the given CompileCommands
+  void clang_CompileCommands_dispose(
+    CXCompileCommands arg0,
+  ) {
+    return _clang_CompileCommands_dispose(
+      arg0,
+    );
+  }
+
+  late final _clang_CompileCommands_disposePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(CXCompileCommands)>>(
+          'clang_CompileCommands_dispose');
+  late final _clang_CompileCommands_dispose = _clang_CompileCommands_disposePtr
+      .asFunction<void Function(CXCompileCommands)>();
+
+  /// Get the number of CompileCommand we have for a file
+  int clang_CompileCommands_getSize(
+    CXCompileCommands arg0,
+  ) {
+    return _clang_CompileCommands_getSize(
+      arg0,
+    );
+  }
+
+  late final _clang_CompileCommands_getSizePtr =
+      _lookup<ffi.NativeFunction<ffi.UnsignedInt Function(CXCompileCommands)>>(
+          'clang_CompileCommands_getSize');
+  late final _clang_CompileCommands_getSize = _clang_CompileCommands_getSizePtr
+      .asFunction<int Function(CXCompileCommands)>();
+
+  /// Get the I'th CompileCommand for a file
+  ///
+  /// Note : 0 <= i < clang_CompileCommands_getSize(CXCompileCommands)
+  CXCompileCommand clang_CompileCommands_getCommand(
+    CXCompileCommands arg0,
+    int I,
+  ) {
+    return _clang_CompileCommands_getCommand(
+      arg0,
+      I,
+    );
+  }
+
+  late final _clang_CompileCommands_getCommandPtr = _lookup<
+      ffi.NativeFunction<
+          CXCompileCommand Function(CXCompileCommands,
+              ffi.UnsignedInt)>>('clang_CompileCommands_getCommand');
+  late final _clang_CompileCommands_getCommand =
+      _clang_CompileCommands_getCommandPtr
+          .asFunction<CXCompileCommand Function(CXCompileCommands, int)>();
+
+  /// Get the working directory where the CompileCommand was executed from
+  CXString clang_CompileCommand_getDirectory(
+    CXCompileCommand arg0,
+  ) {
+    return _clang_CompileCommand_getDirectory(
+      arg0,
+    );
+  }
+
+  late final _clang_CompileCommand_getDirectoryPtr =
+      _lookup<ffi.NativeFunction<CXString Function(CXCompileCommand)>>(
+          'clang_CompileCommand_getDirectory');
+  late final _clang_CompileCommand_getDirectory =
+      _clang_CompileCommand_getDirectoryPtr
+          .asFunction<CXString Function(CXCompileCommand)>();
+
+  /// Get the number of arguments in the compiler invocation.
+  int clang_CompileCommand_getNumArgs(
+    CXCompileCommand arg0,
+  ) {
+    return _clang_CompileCommand_getNumArgs(
+      arg0,
+    );
+  }
+
+  late final _clang_CompileCommand_getNumArgsPtr =
+      _lookup<ffi.NativeFunction<ffi.UnsignedInt Function(CXCompileCommand)>>(
+          'clang_CompileCommand_getNumArgs');
+  late final _clang_CompileCommand_getNumArgs =
+      _clang_CompileCommand_getNumArgsPtr
+          .asFunction<int Function(CXCompileCommand)>();
+
+  /// Get the I'th argument value in the compiler invocations
+  ///
+  /// Invariant :
+  /// - argument 0 is the compiler executable
+  CXString clang_CompileCommand_getArg(
+    CXCompileCommand arg0,
+    int I,
+  ) {
+    return _clang_CompileCommand_getArg(
+      arg0,
+      I,
+    );
+  }
+
+  late final _clang_CompileCommand_getArgPtr = _lookup<
+      ffi.NativeFunction<
+          CXString Function(
+              CXCompileCommand, ffi.UnsignedInt)>>('clang_CompileCommand_getArg');
+  late final _clang_CompileCommand_getArg = _clang_CompileCommand_getArgPtr
+      .asFunction<CXString Function(CXCompileCommand, int)>();
 }
 
 /// A character string.
@@ -2680,6 +2910,31 @@ abstract class CXEvalResultKind {
 /// Evaluation result of a cursor
 typedef CXEvalResult = ffi.Pointer<ffi.Void>;
 
+/// A compilation database holds all information used to compile files in a
+/// project. For each file in the database, it can be queried for the working
+/// directory or the command line used for the compiler invocation.
+///
+/// Must be freed by \c clang_CompilationDatabase_dispose
+typedef CXCompilationDatabase = ffi.Pointer<ffi.Void>;
+
+/// Contains the results of a search in the compilation database
+///
+/// When searching for the compile command for a file, the compilation db can
+/// return several commands, as the file may have been compiled with
+/// different options in different places of the project. This choice of compile
+/// commands is wrapped in this opaque data structure. It must be freed by
+/// \c clang_CompileCommands_dispose.
+typedef CXCompileCommands = ffi.Pointer<ffi.Void>;
+
+/// Represents the command line invocation to compile a specific file.
+typedef CXCompileCommand = ffi.Pointer<ffi.Void>;
+
+/// Error codes for Compilation Database
+abstract class CXCompilationDatabase_Error {
+  static const int CXCompilationDatabase_NoError = 0;
+  static const int CXCompilationDatabase_CanNotLoadDatabase = 1;
+}
+
 const int CINDEX_VERSION_MAJOR = 0;
 
 const int CINDEX_VERSION_MINOR = 59;
@@ -0,0 +1,120 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:ffi';
+import 'dart:io';
+
+import 'package:ffi/ffi.dart';
+import 'package:logging/logging.dart';
+import 'package:path/path.dart' as p;
+
+import 'clang_bindings/clang_bindings.dart' as clang_types;
+import 'data.dart';
+import 'utils.dart';
+
+final _logger = Logger('ffigen.header_parser.compilation_database');
+
+/// Entry points which are parsed together in a single translation unit.
+class HeaderGroup {
+  /// Compiler options shared by all [headers], in addition to the ones from
+  /// the config.
+  final List<String> compilerOpts;
+
+  final List<String> headers;
+
+  HeaderGroup(this.compilerOpts, this.headers);
+}
+
+/// Groups [headers] by the compiler options recorded for them in the
+/// compilation database in [buildDirectory].
+///
+/// Headers without a compile command only use the compiler options from the
+/// config, so they are grouped together as well. If the database can't be
+/// loaded, every header is parsed on its own.
+List<HeaderGroup> groupHeadersByCompileCommand(
+    String buildDirectory, List<String> headers) {
+  final buildDirectoryPtr = buildDirectory.toNativeUtf8();
+  final errorCode = calloc<Int32>();
+  final db = clang.clang_CompilationDatabase_fromDirectory(
+      buildDirectoryPtr.cast(), errorCode);
+  final error = errorCode.value;
+  calloc.free(buildDirectoryPtr);
+  calloc.free(errorCode);
+
+  if (error !=
+      clang_types.CXCompilationDatabase_Error.CXCompilationDatabase_NoError) {
+    _logger.severe("Couldn't load compilation database from $buildDirectory, "
+        'ignoring it.');
+    return [
+      for (final header in headers) HeaderGroup(const [], [header])
+    ];
+  }
+
+  final groups = <String, HeaderGroup>{};
+  for (final header in headers) {
+    final compilerOpts = _compilerOptsForFile(db, File(header).absolute.path);
+    final key = compilerOpts.join('\x00');
+    (groups[key] ??= HeaderGroup(compilerOpts, [])).headers.add(header);
+  }
+  clang.clang_CompilationDatabase_dispose(db);
+
+  _logger.fine(() => 'Grouped ${headers.length} headers into '
+      '${groups.length} translation units using the compilation database.');
+  return groups.values.toList();
+}
+
+List<String> _compilerOptsForFile(
+    clang_types.CXCompilationDatabase db, String file) {
+  final filePtr = file.toNativeUtf8();
+  final commands =
+      clang.clang_CompilationDatabase_getCompileCommands(db, filePtr.cast());
+  calloc.free(filePtr);
+
+  var compilerOpts = <String>[];
+  if (clang.clang_CompileCommands_getSize(commands) > 0) {
+    // If a file is compiled more than once, the first command is used.
+    final command = clang.clang_CompileCommands_getCommand(commands, 0);
+    final directory =
+        clang.clang_CompileCommand_getDirectory(command).toStringAndDispose();
+    final numArgs = clang.clang_CompileCommand_getNumArgs(command);
+    compilerOpts = compileCommandToCompilerOpts(directory, file, [
+      // The first argument is the compiler executable.
+      for (var i = 1; i < numArgs; i++)
+        clang.clang_CompileCommand_getArg(command, i).toStringAndDispose(),
+    ]);
+  }
+  clang.clang_CompileCommands_dispose(commands);
+  return compilerOpts;
+}
+
+/// Options of a compile command which don't affect parsing.
+const _skippedCompilerOpts = {'-c', '-S', '-E', '-MD', '-MMD', '-MP', '--'};
+
+/// Options of a compile command which don't affect parsing, and are followed
+/// by a value.
+const _skippedCompilerOptsWithValue = {'-o', '-MF', '-MT', '-MQ'};
+
+/// Converts the arguments of a compile command for [file], without the
+/// compiler executable, to compiler options for parsing it.
+///
+/// The input file and the output options are removed. Relative paths in the
+/// options are resolved against the [directory] the command was run in.
+List<String> compileCommandToCompilerOpts(
+    String directory, String file, List<String> args) {
+  final compilerOpts = [
+    if (directory.isNotEmpty) '-working-directory=$directory',
+  ];
+  for (var i = 0; i < args.length; i++) {
+    final arg = args[i];
+    final isOutput = arg.startsWith('-o') && arg.length > 2;
+    final isInput =
+        !arg.startsWith('-') && p.equals(p.join(directory, arg), file);
+    if (_skippedCompilerOptsWithValue.contains(arg)) {
+      i++;
+    } else if (!_skippedCompilerOpts.contains(arg) && !isOutput && !isInput) {
+      compilerOpts.add(arg);
+    }
+  }
+  return compilerOpts;
+}
@@ -7,7 +7,8 @@ import 'dart:ffi';
 import 'package:ffigen/src/code_generator.dart'
     show Constant, ObjCBuiltInFunctions;
 import 'package:ffigen/src/config_provider.dart' show Config;
-import 'clang_bindings/clang_bindings.dart' show Clang;
+import 'package:ffigen/src/declaration_ir.dart' show SourceLocation;
+import 'clang_bindings/clang_bindings.dart' show Clang, CXCursor;
 
 import 'utils.dart';
 
@@ -41,17 +42,30 @@ Map<String, Macro> _savedMacros = {};
 List<Constant> get unnamedEnumConstants => _unnamedEnumConstants;
 List<Constant> _unnamedEnumConstants = [];
 
+/// Locations of root declarations, keyed by USR. Only collected when a
+/// declaration IR is written.
+Map<String, SourceLocation> get declarationLocations => _declarationLocations;
+Map<String, SourceLocation> _declarationLocations = {};
+
+/// Categories of ObjC interfaces which were skipped because the interface was
+/// a stub, keyed by the USR of the interface.
+Map<String, List<CXCursor>> get skippedObjCCategories => _skippedObjCCategories;
+Map<String, List<CXCursor>> _skippedObjCCategories = {};
+
 /// Built in functions used by the Objective C bindings.
 ObjCBuiltInFunctions get objCBuiltInFunctions => _objCBuiltInFunctions;
 late ObjCBuiltInFunctions _objCBuiltInFunctions;
 
-void initializeGlobals({required Config config}) {
+void initializeGlobals({required Config config, Clang? clang}) {
   _config = config;
-  _clang = Clang(DynamicLibrary.open(config.libclangDylib));
+  _clang = clang ?? Clang(DynamicLibrary.open(config.libclangDylib));
   _incrementalNamer = IncrementalNamer();
   _savedMacros = {};
   _unnamedEnumConstants = [];
+  _declarationLocations = {};
+  _skippedObjCCategories = {};
   _cursorIndex = CursorIndex();
   _bindingsIndex = BindingsIndex();
-  _objCBuiltInFunctions = ObjCBuiltInFunctions();
+  _objCBuiltInFunctions =
+      ObjCBuiltInFunctions(borrowedViews: config.objcBorrowedViews);
 }
@@ -0,0 +1,72 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/config_provider.dart';
+import 'package:ffigen/src/strings.dart' as strings;
+import 'package:logging/logging.dart';
+
+final _logger = Logger('ffigen.header_parser.finalizable_handles');
+
+/// Creates the handle classes configured by `finalizable-handles`, for the
+/// structs and functions found in [bindings] or their dependencies.
+List<Binding> finalizableHandles(Config c, List<Binding> bindings) {
+  if (c.finalizableHandles.isEmpty) return const [];
+
+  final all = <Binding>{};
+  for (final b in bindings) {
+    b.addDependencies(all);
+  }
+  final compounds = {
+    for (final b in all.whereType<Compound>()) b.originalName: b,
+  };
+  final funcs = {for (final b in all.whereType<Func>()) b.originalName: b};
+
+  final handles = <Binding>[];
+  for (final MapEntry(key: name, value: handle)
+      in c.finalizableHandles.entries) {
+    final compound = compounds[name];
+    final destructor = funcs[handle.destructor];
+    final size = handle.size == null ? null : funcs[handle.size];
+    if (compound == null) {
+      _logger.severe('${strings.finalizableHandles}: No struct or union '
+          "named '$name' was generated, skipping its handle.");
+    } else if (destructor == null ||
+        !_isDestructorOf(destructor.functionType, compound)) {
+      _logger.severe("${strings.finalizableHandles}: Destructor '"
+          "${handle.destructor}' of '$name' must be a generated function "
+          "taking a pointer to '$name' and returning void, skipping its "
+          'handle.');
+    } else if (destructor.ffiNativeConfig.enabled) {
+      _logger.severe("${strings.finalizableHandles}: Destructor '"
+          "${handle.destructor}' of '$name' is generated as @Native, but its "
+          'address has to be looked up, skipping its handle.');
+    } else if (handle.size != null &&
+        (size == null || !_isSizeOf(size.functionType, compound))) {
+      _logger.severe("${strings.finalizableHandles}: Size function '"
+          "${handle.size}' of '$name' must be a generated function taking a "
+          "pointer to '$name' and returning an integer, skipping its handle.");
+    } else {
+      handles.add(FinalizableHandle(
+          compound: compound, destructor: destructor, size: size));
+    }
+  }
+  return handles;
+}
+
+bool _takesPointerTo(FunctionType f, Compound compound) {
+  if (f.parameters.length != 1 || f.varArgParameters.isNotEmpty) return false;
+  final type = f.parameters.first.type.typealiasType;
+  return type is PointerType && type.child.typealiasType == compound;
+}
+
+bool _isDestructorOf(FunctionType f, Compound compound) =>
+    _takesPointerTo(f, compound) && f.returnType.typealiasType == voidType;
+
+bool _isSizeOf(FunctionType f, Compound compound) {
+  final returnType = f.returnType.typealiasType;
+  return _takesPointerTo(f, compound) &&
+      ((returnType is ImportedType && returnType.dartType == 'int') ||
+          (returnType is NativeType && returnType.isInteger));
+}
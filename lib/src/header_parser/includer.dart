@@ -9,55 +9,71 @@ import '../config_provider/config_types.dart';
 import '../strings.dart' as strings;
 import 'data.dart';
 
-bool _shouldIncludeDecl(
-    String usr,
-    String name,
-    bool Function(String) isSeenDecl,
-    bool Function(String, bool) configIncludes) {
+bool _shouldIncludeDecl(String usr, String name,
+    bool Function(String) isSeenDecl, Declaration configDecl,
+    {bool checkUsageManifest = true}) {
   if (isSeenDecl(usr) || name == '') {
     return false;
   } else if (config.usrTypeMappings.containsKey(usr)) {
     return false;
-  } else if (configIncludes(name, config.excludeAllByDefault)) {
+  } else if (checkUsageManifest && !_isInUsageManifest(name, configDecl)) {
+    return false;
+  } else if (configDecl.shouldInclude(name, config.excludeAllByDefault)) {
     return true;
   } else {
     return false;
   }
 }
 
+/// True if there is no usage manifest, or if the manifest refers to the
+/// declaration by its original or generated name.
+bool _isInUsageManifest(String name, Declaration configDecl) {
+  final manifest = config.usageManifest;
+  return manifest == null ||
+      manifest.isUsed(name, configDecl.renameUsingConfig(name));
+}
+
+/// True if a usage manifest is set and it doesn't refer to the root
+/// declaration [name]. Such declarations are skipped before their type is
+/// extracted, they are only parsed if another declaration depends on them.
+bool isUnusedRootDecl(String name, Declaration configDecl) {
+  if (name == '') return false;
+  return !_isInUsageManifest(name, configDecl);
+}
+
 bool shouldIncludeStruct(String usr, String name) {
   return _shouldIncludeDecl(
-      usr, name, bindingsIndex.isSeenType, config.structDecl.shouldInclude);
+      usr, name, bindingsIndex.isSeenType, config.structDecl);
 }
 
 bool shouldIncludeUnion(String usr, String name) {
   return _shouldIncludeDecl(
-      usr, name, bindingsIndex.isSeenType, config.unionDecl.shouldInclude);
+      usr, name, bindingsIndex.isSeenType, config.unionDecl);
 }
 
 bool shouldIncludeFunc(String usr, String name) {
   return _shouldIncludeDecl(
-      usr, name, bindingsIndex.isSeenFunc, config.functionDecl.shouldInclude);
+      usr, name, bindingsIndex.isSeenFunc, config.functionDecl);
 }
 
 bool shouldIncludeEnumClass(String usr, String name) {
   return _shouldIncludeDecl(
-      usr, name, bindingsIndex.isSeenType, config.enumClassDecl.shouldInclude);
+      usr, name, bindingsIndex.isSeenType, config.enumClassDecl);
 }
 
 bool shouldIncludeUnnamedEnumConstant(String usr, String name) {
   return _shouldIncludeDecl(usr, name, bindingsIndex.isSeenUnnamedEnumConstant,
-      config.unnamedEnumConstants.shouldInclude);
+      config.unnamedEnumConstants);
 }
 
 bool shouldIncludeGlobalVar(String usr, String name) {
   return _shouldIncludeDecl(
-      usr, name, bindingsIndex.isSeenGlobalVar, config.globals.shouldInclude);
+      usr, name, bindingsIndex.isSeenGlobalVar, config.globals);
 }
 
 bool shouldIncludeMacro(String usr, String name) {
   return _shouldIncludeDecl(
-      usr, name, bindingsIndex.isSeenMacro, config.macroDecl.shouldInclude);
+      usr, name, bindingsIndex.isSeenMacro, config.macroDecl);
 }
 
 bool shouldIncludeTypealias(String usr, String name) {
@@ -65,13 +81,20 @@ bool shouldIncludeTypealias(String usr, String name) {
   if (config.language == Language.objc && name == strings.objcInstanceType) {
     return true;
   }
+  // Typedefs are only generated when referred to by another declaration, so
+  // they are kept regardless of the usage manifest.
   return _shouldIncludeDecl(
-      usr, name, bindingsIndex.isSeenType, config.typedefs.shouldInclude);
+    usr,
+    name,
+    bindingsIndex.isSeenType,
+    config.typedefs,
+    checkUsageManifest: false,
+  );
 }
 
 bool shouldIncludeObjCInterface(String usr, String name) {
   return _shouldIncludeDecl(
-      usr, name, bindingsIndex.isSeenType, config.objcInterfaces.shouldInclude);
+      usr, name, bindingsIndex.isSeenType, config.objcInterfaces);
 }
 
 /// True if a cursor should be included based on headers config, used on root
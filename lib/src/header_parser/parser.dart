@@ -9,13 +9,17 @@ import 'package:ffi/ffi.dart';
 import 'package:ffigen/src/code_generator.dart';
 import 'package:ffigen/src/config_provider.dart';
 import 'package:ffigen/src/config_provider/config_types.dart';
+import 'package:ffigen/src/declaration_ir.dart';
 import 'package:ffigen/src/header_parser/sub_parsers/macro_parser.dart';
 import 'package:ffigen/src/header_parser/translation_unit_parser.dart';
 import 'package:ffigen/src/strings.dart' as strings;
 import 'package:logging/logging.dart';
+import 'package:path/path.dart' as p;
 
 import 'clang_bindings/clang_bindings.dart' as clang_types;
+import 'compilation_database.dart';
 import 'data.dart';
+import 'finalizable_handles.dart';
 import 'utils.dart';
 
 /// Main entrypoint for header_parser.
@@ -24,17 +28,45 @@ Library parse(Config c) {
 
   final bindings = parseToBindings();
 
-  final library = Library(
-    bindings: bindings,
-    name: config.wrapperName,
-    description: config.wrapperDocComment,
-    header: config.preamble,
-    sort: config.sort,
-    packingOverride: config.structPackingOverride,
+  if (c.irOutput != null) {
+    final irFile = File(c.irOutput!);
+    writeIrFile(irFile, bindings, locations: declarationLocations);
+    _logger.info('Declaration IR written to ${irFile.absolute.path}');
+  }
+
+  return _buildLibrary(c, bindings);
+}
+
+/// Builds the [Library] from a declaration IR file written by a previous run,
+/// without parsing any headers.
+///
+/// The declarations were filtered and renamed when the IR was written. The
+/// code generation options of [c], such as `functions`, `ffi-native` and
+/// `enums -> as-dart-enums`, are applied here, so one IR file can be used to
+/// generate both lookup and `@Native` bindings.
+///
+/// Passing the same [dependencyGraph] when the IR file is read again, e.g.
+/// after it's been rewritten by a new run, only traverses the declarations
+/// which changed since the last call.
+Library parseIr(Config c, File irFile, {DependencyGraph? dependencyGraph}) {
+  final bindings = readIrFile(irFile, c, dependencyGraph: dependencyGraph);
+  return _buildLibrary(c, bindings, dependencyGraph);
+}
+
+Library _buildLibrary(Config c, List<Binding> bindings,
+    [DependencyGraph? dependencyGraph]) {
+  return Library(
+    bindings: [...bindings, ...finalizableHandles(c, bindings)],
+    name: c.wrapperName,
+    description: c.wrapperDocComment,
+    header: c.preamble,
+    sort: c.sort,
+    packingOverride: c.structPackingOverride,
     libraryImports: c.libraryImports.values.toSet(),
+    verifyCompoundLayouts: c.compoundLayout.verify,
+    sharedSymbolTable: c.sharedSymbolTable,
+    dependencyGraph: dependencyGraph,
   );
-
-  return library;
 }
 
 // ===================================================================================
@@ -44,10 +76,14 @@ Library parse(Config c) {
 final _logger = Logger('ffigen.header_parser.parser');
 
 /// Initializes parser, clears any previous values.
-void initParser(Config c) {
+///
+/// The libclang bindings are loaded from [c], unless [clang] is given, e.g. to
+/// observe the calls made by the parser in tests.
+void initParser(Config c, {clang_types.Clang? clang}) {
   // Initialize global variables.
   initializeGlobals(
     config: c,
+    clang: clang,
   );
 }
 
@@ -55,8 +91,7 @@ void initParser(Config c) {
 List<Binding> parseToBindings() {
   final index = clang.clang_createIndex(0, 0);
 
-  Pointer<Pointer<Utf8>> clangCmdArgs = nullptr;
-  final compilerOpts = <String>[
+  final defaultCompilerOpts = <String>[
     // Add compiler opt for comment parsing for clang based on config.
     if (config.commentType.length != CommentLength.none &&
         config.commentType.style == CommentStyle.any)
@@ -67,50 +102,60 @@ List<Binding> parseToBindings() {
       ...strings.clangLangObjC,
       ..._findObjectiveCSysroot(),
     ],
-
-    // Add the user options last so they can override any other options.
-    ...config.compilerOpts
   ];
 
-  _logger.fine('CompilerOpts used: $compilerOpts');
-  clangCmdArgs = createDynamicStringArray(compilerOpts);
-  final cmdLen = compilerOpts.length;
-
   // Contains all bindings. A set ensures we never have duplicates.
   final bindings = <Binding>{};
 
   // Log all headers for user.
   _logger.info('Input Headers: ${config.headers.entryPoints}');
 
+  // Without a compilation database, every entry point is parsed on its own.
+  final headerGroups = config.compilationDatabase == null
+      ? [
+          for (final header in config.headers.entryPoints)
+            HeaderGroup(const [], [header])
+        ]
+      : groupHeadersByCompileCommand(
+          config.compilationDatabase!, config.headers.entryPoints);
+
   final tuList = <Pointer<clang_types.CXTranslationUnitImpl>>[];
+  // Index of the header group each translation unit was parsed from.
+  final tuGroups = <int>[];
 
   // Parse all translation units from entry points.
-  for (final headerLocation in config.headers.entryPoints) {
-    _logger.fine('Creating TranslationUnit for header: $headerLocation');
-
-    final tu = clang.clang_parseTranslationUnit(
-      index,
-      headerLocation.toNativeUtf8().cast(),
-      clangCmdArgs.cast(),
-      cmdLen,
-      nullptr,
-      0,
-      clang_types.CXTranslationUnit_Flags.CXTranslationUnit_SkipFunctionBodies |
-          clang_types.CXTranslationUnit_Flags
-              .CXTranslationUnit_DetailedPreprocessingRecord |
-          clang_types
-              .CXTranslationUnit_Flags.CXTranslationUnit_IncludeAttributedTypes,
-    );
+  for (var i = 0; i < headerGroups.length; i++) {
+    final group = headerGroups[i];
+    final compilerOpts = [
+      ...defaultCompilerOpts,
+      ...group.compilerOpts,
+
+      // Add the user options last so they can override any other options.
+      ...config.compilerOpts
+    ];
+    _logger.fine(() => 'CompilerOpts used: $compilerOpts');
 
+    final Pointer<clang_types.CXTranslationUnitImpl> tu;
+    if (group.headers.length > 1) {
+      tu = _parseUmbrellaTranslationUnit(index, i, group.headers, compilerOpts);
+    } else if (group.compilerOpts.isEmpty) {
+      tu = _parseTranslationUnit(index, group.headers.single, compilerOpts);
+    } else {
+      // The compile command may change the working directory.
+      tu = _parseTranslationUnit(
+          index, File(group.headers.single).absolute.path, compilerOpts);
+    }
     if (tu == nullptr) {
       _logger.severe(
-          "Skipped header/file: $headerLocation, couldn't parse source.");
-      // Skip parsing this header.
+          "Skipped header/file: ${group.headers.join(', ')}, couldn't parse "
+          'source.');
+      // Skip parsing these headers.
       continue;
     }
 
-    logTuDiagnostics(tu, _logger, headerLocation);
+    logTuDiagnostics(tu, _logger, group.headers.join(', '));
     tuList.add(tu);
+    tuGroups.add(i);
   }
 
   final tuCursors =
@@ -121,9 +166,16 @@ List<Binding> parseToBindings() {
     buildUsrCursorDefinitionMap(rootCursor);
   }
 
+  // Without a compilation database, all macros are evaluated together with
+  // the user options, as in a single group of all entry points.
+  final macroGroups = config.compilationDatabase == null
+      ? [HeaderGroup(const [], config.headers.entryPoints)]
+      : headerGroups;
+
   // Parse definitions from translation units.
-  for (final rootCursor in tuCursors) {
-    bindings.addAll(parseTranslationUnit(rootCursor));
+  for (final (i, rootCursor) in tuCursors.indexed) {
+    bindings.addAll(parseTranslationUnit(rootCursor,
+        headerGroup: config.compilationDatabase == null ? 0 : tuGroups[i]));
   }
 
   // Dispose translation units.
@@ -135,13 +187,71 @@ List<Binding> parseToBindings() {
   bindings.addAll(unnamedEnumConstants);
 
   // Parse all saved macros.
-  bindings.addAll(parseSavedMacros()!);
+  bindings.addAll(parseSavedMacros(macroGroups)!);
 
-  clangCmdArgs.dispose(cmdLen);
   clang.clang_disposeIndex(index);
   return bindings.toList();
 }
 
+Pointer<clang_types.CXTranslationUnitImpl> _parseTranslationUnit(
+  clang_types.CXIndex index,
+  String source,
+  List<String> compilerOpts, [
+  Pointer<clang_types.CXUnsavedFile>? unsavedFile,
+]) {
+  _logger.fine(() => 'Creating TranslationUnit for header: $source');
+
+  final clangCmdArgs = createDynamicStringArray(compilerOpts);
+  final sourcePtr = source.toNativeUtf8();
+  final tu = clang.clang_parseTranslationUnit(
+    index,
+    sourcePtr.cast(),
+    clangCmdArgs.cast(),
+    compilerOpts.length,
+    unsavedFile ?? nullptr,
+    unsavedFile == null ? 0 : 1,
+    clang_types.CXTranslationUnit_Flags.CXTranslationUnit_SkipFunctionBodies |
+        clang_types.CXTranslationUnit_Flags
+            .CXTranslationUnit_DetailedPreprocessingRecord |
+        clang_types
+            .CXTranslationUnit_Flags.CXTranslationUnit_IncludeAttributedTypes,
+  );
+  calloc.free(sourcePtr);
+  clangCmdArgs.dispose(compilerOpts.length);
+  return tu;
+}
+
+/// Parses [headers] as a single translation unit, using an in-memory umbrella
+/// header which includes all of them.
+Pointer<clang_types.CXTranslationUnitImpl> _parseUmbrellaTranslationUnit(
+  clang_types.CXIndex index,
+  int groupIndex,
+  List<String> headers,
+  List<String> compilerOpts,
+) {
+  // The umbrella header only exists in memory. Its path is absolute, since the
+  // compile command may change the working directory.
+  final umbrella =
+      p.join(Directory.current.absolute.path, 'ffigen_umbrella_$groupIndex.h');
+  final contents = StringBuffer();
+  for (final h in headers) {
+    contents.writeln('#include "${File(h).absolute.path}"');
+  }
+
+  final unsavedFile = calloc<clang_types.CXUnsavedFile>();
+  final umbrellaPtr = umbrella.toNativeUtf8();
+  final contentsPtr = contents.toString().toNativeUtf8();
+  unsavedFile.ref
+    ..Filename = umbrellaPtr.cast()
+    ..Contents = contentsPtr.cast()
+    ..Length = contentsPtr.length;
+  final tu = _parseTranslationUnit(index, umbrella, compilerOpts, unsavedFile);
+  calloc.free(umbrellaPtr);
+  calloc.free(contentsPtr);
+  calloc.free(unsavedFile);
+  return tu;
+}
+
 List<String> _findObjectiveCSysroot() {
   final result = Process.runSync('xcrun', ['--show-sdk-path']);
   if (result.exitCode == 0) {
@@ -28,15 +28,19 @@ class _ParsedCompound {
   bool unimplementedMemberType = false;
   bool flexibleArrayMember = false;
   bool bitFieldMember = false;
+  bool unsupportedBitFieldLayout = false;
   bool dartHandleMember = false;
   bool incompleteCompoundMember = false;
 
+  /// Size and alignment in bytes of the type of each member.
+  final memberLayouts = <Member, (int size, int alignment)>{};
+
   _ParsedCompound(this.compound);
 
   bool get isIncomplete =>
       unimplementedMemberType ||
       flexibleArrayMember ||
-      bitFieldMember ||
+      unsupportedBitFieldLayout ||
       (dartHandleMember && config.useDartHandle) ||
       incompleteCompoundMember ||
       alignment == clang_types.CXTypeLayoutError.CXTypeLayoutError_Incomplete;
@@ -133,12 +137,13 @@ Compound? parseCompoundDeclaration(
         name: incrementalNamer.name('Unnamed$className'),
         usr: declUsr,
         dartDoc: getCursorDocComment(cursor),
+        generateLayoutTable: config.compoundLayout.tables,
       );
     } else {
-      _logger.finest('unnamed $className declaration');
+      _logger.finest(() => 'unnamed $className declaration');
     }
   } else if (ignoreFilter || shouldIncludeDecl(declUsr, declName)) {
-    _logger.fine(
+    _logger.fine(() =>
         '++++ Adding $className: Name: $declName, ${cursor.completeStringRepr()}');
     return Compound.fromType(
       type: compoundType,
@@ -146,6 +151,9 @@ Compound? parseCompoundDeclaration(
       originalName: declName,
       name: configDecl.renameUsingConfig(declName),
       dartDoc: getCursorDocComment(cursor),
+      generateLayoutTable: config.compoundLayout.tables,
+      generateOffsetAccessors:
+          config.compoundLayout.offsetAccessors.shouldInclude(declName),
     );
   }
   return null;
@@ -192,34 +200,39 @@ void fillCompoundMembersIfNeeded(
   );
   _stack.pop();
 
-  _logger.finest(
+  _logger.finest(() =>
       'Opaque: ${parsed.isIncomplete}, HasAttr: ${parsed.hasAttr}, AlignValue: ${parsed.alignment}, MaxChildAlignValue: ${parsed.maxChildAlignment}, PackValue: ${parsed.packValue}.');
-  compound.pack = parsed.packValue;
+  var pack = parsed.packValue;
+  if (parsed.bitFieldMember && !parsed.isIncomplete) {
+    _layoutBitFields(parsed, pack, cursor.type().size());
+    if (parsed.isIncomplete) pack = null;
+  }
+  compound.pack = pack;
 
   visitChildrenResultChecker(resultCode);
 
   if (parsed.unimplementedMemberType) {
-    _logger.fine(
+    _logger.fine(() =>
         '---- Removed $className members, reason: member with unimplementedtype ${cursor.completeStringRepr()}');
     _logger.warning(
         'Removed All $className Members from ${compound.name}(${compound.originalName}), struct member has an unsupported type.');
   } else if (parsed.flexibleArrayMember) {
-    _logger.fine(
+    _logger.fine(() =>
         '---- Removed $className members, reason: incomplete array member ${cursor.completeStringRepr()}');
     _logger.warning(
         'Removed All $className Members from ${compound.name}(${compound.originalName}), Flexible array members not supported.');
-  } else if (parsed.bitFieldMember) {
-    _logger.fine(
+  } else if (parsed.unsupportedBitFieldLayout) {
+    _logger.fine(() =>
         '---- Removed $className members, reason: bitfield members ${cursor.completeStringRepr()}');
     _logger.warning(
-        'Removed All $className Members from ${compound.name}(${compound.originalName}), Bit Field members not supported.');
+        'Removed All $className Members from ${compound.name}(${compound.originalName}), Bit Field members with this layout are not supported.');
   } else if (parsed.dartHandleMember && config.useDartHandle) {
-    _logger.fine(
+    _logger.fine(() =>
         '---- Removed $className members, reason: Dart_Handle member. ${cursor.completeStringRepr()}');
     _logger.warning(
         'Removed All $className Members from ${compound.name}(${compound.originalName}), Dart_Handle member not supported.');
   } else if (parsed.incompleteCompoundMember) {
-    _logger.fine(
+    _logger.fine(() =>
         '---- Removed $className members, reason: Incomplete Nested Struct member. ${cursor.completeStringRepr()}');
     _logger.warning(
         'Removed All $className Members from ${compound.name}(${compound.originalName}), Incomplete Nested Struct member not supported.');
@@ -233,6 +246,13 @@ void fillCompoundMembersIfNeeded(
   // C allows empty structs/union, but it's undefined behaviour at runtine.
   // So we need to mark a declaration incomplete if it has no members.
   compound.isIncomplete = parsed.isIncomplete || compound.members.isEmpty;
+
+  // Record the layout computed by clang, used for layout tables.
+  if (!compound.isIncomplete) {
+    final size = cursor.type().size();
+    compound.size = size < 0 ? null : size;
+    compound.alignment = parsed.alignment < 0 ? null : parsed.alignment;
+  }
 }
 
 /// Visitor for the struct/union cursor [CXCursorKind.CXCursor_StructDecl]/
@@ -245,7 +265,7 @@ int _compoundMembersVisitor(clang_types.CXCursor cursor,
   try {
     switch (cursor.kind) {
       case clang_types.CXCursorKind.CXCursor_FieldDecl:
-        _logger.finer('===== member: ${cursor.completeStringRepr()}');
+        _logger.finer(() => '===== member: ${cursor.completeStringRepr()}');
 
         // Set maxChildAlignValue.
         final align = cursor.type().alignment();
@@ -258,8 +278,8 @@ int _compoundMembersVisitor(clang_types.CXCursor cursor,
           // TODO(68): Structs with flexible Array Members are not supported.
           parsed.flexibleArrayMember = true;
         }
-        if (clang.clang_getFieldDeclBitWidth(cursor) != -1) {
-          // TODO(84): Struct with bitfields are not suppoorted.
+        final bitWidth = clang.clang_getFieldDeclBitWidth(cursor);
+        if (bitWidth != -1) {
           parsed.bitFieldMember = true;
         }
         if (mt is HandleType) {
@@ -271,20 +291,23 @@ int _compoundMembersVisitor(clang_types.CXCursor cursor,
         if (mt.baseType is UnimplementedType) {
           parsed.unimplementedMemberType = true;
         }
-        parsed.compound.members.add(
-          Member(
-            dartDoc: getCursorDocComment(
-              cursor,
-              nesting.length + commentPrefix.length,
-            ),
-            originalName: cursor.spelling(),
-            name: config.structDecl.renameMemberUsingConfig(
-              parsed.compound.originalName,
-              cursor.spelling(),
-            ),
-            type: mt,
+        final member = Member(
+          dartDoc: getCursorDocComment(
+            cursor,
+            nesting.length + commentPrefix.length,
           ),
+          originalName: cursor.spelling(),
+          name: config.structDecl.renameMemberUsingConfig(
+            parsed.compound.originalName,
+            cursor.spelling(),
+          ),
+          type: mt,
+          offsetInBits: _offsetOfField(cursor),
+          bitWidth: bitWidth == -1 ? null : bitWidth,
+          isSignedBitField: bitWidth != -1 && _isSignedIntegerType(cursor),
         );
+        parsed.compound.members.add(member);
+        parsed.memberLayouts[member] = (cursor.type().size(), align);
 
         break;
 
@@ -308,20 +331,21 @@ int _compoundMembersVisitor(clang_types.CXCursor cursor,
         // use the empty string as spelling.
         final spelling = '';
 
-        parsed.compound.members.add(
-          Member(
-            dartDoc: getCursorDocComment(
-              cursor,
-              nesting.length + commentPrefix.length,
-            ),
-            originalName: spelling,
-            name: config.structDecl.renameMemberUsingConfig(
-              parsed.compound.originalName,
-              spelling,
-            ),
-            type: mt,
+        final member = Member(
+          dartDoc: getCursorDocComment(
+            cursor,
+            nesting.length + commentPrefix.length,
+          ),
+          originalName: spelling,
+          name: config.structDecl.renameMemberUsingConfig(
+            parsed.compound.originalName,
+            spelling,
           ),
+          type: mt,
         );
+        parsed.compound.members.add(member);
+        parsed.memberLayouts[member] =
+            (cursor.type().size(), cursor.type().alignment());
 
         break;
     }
@@ -333,6 +357,141 @@ int _compoundMembersVisitor(clang_types.CXCursor cursor,
   return clang_types.CXChildVisitResult.CXChildVisit_Continue;
 }
 
+/// Replaces the bit field members of a struct with the storage units holding
+/// them, followed by the bit fields themselves, which are generated as
+/// accessors on their storage unit.
+///
+/// The bytes between a run of bit fields and the next member are split into
+/// aligned unsigned integers (taking [pack] into account), no wider than the
+/// widest declared type of the run. Marks the compound as incomplete if a bit
+/// field would straddle two storage units, or if the resulting Dart layout
+/// doesn't match the one computed by clang.
+void _layoutBitFields(_ParsedCompound parsed, int? pack, int size) {
+  final compound = parsed.compound;
+  final members = compound.members;
+  if (compound.isUnion ||
+      size < 0 ||
+      members.any((m) => m.offsetInBits == null)) {
+    parsed.unsupportedBitFieldLayout = true;
+    return;
+  }
+
+  final result = <Member>[];
+  var storageCount = 0;
+  for (var i = 0; i < members.length;) {
+    if (!members[i].isBitField) {
+      result.add(members[i++]);
+      continue;
+    }
+
+    final start = i;
+    var unitSize = 1;
+    while (i < members.length && members[i].isBitField) {
+      final typeSize = parsed.memberLayouts[members[i]]!.$1;
+      if (typeSize > unitSize) unitSize = typeSize;
+      i++;
+    }
+    final run = members.sublist(start, i);
+    final startByte = run.first.offsetInBits! ~/ 8;
+    final endByte =
+        i < members.length ? members[i].offsetInBits! ~/ 8 : size;
+
+    final storages = <Member>[];
+    for (var offset = startByte; offset < endByte;) {
+      var storageSize = unitSize;
+      while (offset % _packedAlignment(storageSize, pack) != 0 ||
+          offset + storageSize > endByte) {
+        storageSize ~/= 2;
+      }
+      final storage = Member(
+        name: '_bitfield${storageCount++}',
+        type: NativeType(_unsignedTypes[storageSize]!),
+        offsetInBits: offset * 8,
+      );
+      storages.add(storage);
+      parsed.memberLayouts[storage] = (storageSize, storageSize);
+      offset += storageSize;
+    }
+    result.addAll(storages);
+
+    for (final m in run) {
+      // Unnamed bit fields are only padding.
+      if (m.bitWidth == 0 || m.originalName.isEmpty) continue;
+      final begin = m.offsetInBits!;
+      final end = begin + m.bitWidth!;
+      for (final storage in storages) {
+        final storageBegin = storage.offsetInBits!;
+        final storageEnd = storageBegin + parsed.memberLayouts[storage]!.$1 * 8;
+        if (begin >= storageBegin && end <= storageEnd) {
+          m.bitFieldStorage = storage;
+          break;
+        }
+      }
+      if (m.bitFieldStorage == null) {
+        parsed.unsupportedBitFieldLayout = true;
+        return;
+      }
+      result.add(m);
+    }
+  }
+
+  // Check that the Dart layout of the fields matches the clang layout.
+  var offset = 0;
+  var maxAlignment = 1;
+  for (final m in result) {
+    if (m.isBitField) continue;
+    final (memberSize, memberAlignment) = parsed.memberLayouts[m]!;
+    final alignment = _packedAlignment(memberAlignment, pack);
+    offset = (offset + alignment - 1) ~/ alignment * alignment;
+    if (offset * 8 != m.offsetInBits) {
+      parsed.unsupportedBitFieldLayout = true;
+      return;
+    }
+    offset += memberSize;
+    if (alignment > maxAlignment) maxAlignment = alignment;
+  }
+  offset = (offset + maxAlignment - 1) ~/ maxAlignment * maxAlignment;
+  if (offset != size || maxAlignment != parsed.alignment) {
+    parsed.unsupportedBitFieldLayout = true;
+    return;
+  }
+
+  members
+    ..clear()
+    ..addAll(result);
+}
+
+int _packedAlignment(int alignment, int? pack) =>
+    pack == null || alignment < pack ? alignment : pack;
+
+const _unsignedTypes = {
+  1: SupportedNativeType.Uint8,
+  2: SupportedNativeType.Uint16,
+  4: SupportedNativeType.Uint32,
+  8: SupportedNativeType.Uint64,
+};
+
+/// Returns true if the type of the field at [cursor] is a signed integer.
+bool _isSignedIntegerType(clang_types.CXCursor cursor) {
+  switch (clang.clang_getCanonicalType(cursor.type()).kind) {
+    case clang_types.CXTypeKind.CXType_Char_S:
+    case clang_types.CXTypeKind.CXType_SChar:
+    case clang_types.CXTypeKind.CXType_Short:
+    case clang_types.CXTypeKind.CXType_Int:
+    case clang_types.CXTypeKind.CXType_Long:
+    case clang_types.CXTypeKind.CXType_LongLong:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Returns the offset of a field in bits, or null if clang can't compute it.
+int? _offsetOfField(clang_types.CXCursor cursor) {
+  final offset = clang.clang_Cursor_getOffsetOfField(cursor);
+  return offset < 0 ? null : offset;
+}
+
 String _compoundTypeDebugName(CompoundType compoundType) {
   return compoundType == CompoundType.struct ? "Struct" : "Union";
 }
@@ -57,12 +57,13 @@ EnumClass? parseEnumDeclaration(
     _logger.fine('Saving anonymous enum.');
     saveUnNamedEnum(cursor);
   } else if (ignoreFilter || shouldIncludeEnumClass(enumUsr, enumName)) {
-    _logger.fine('++++ Adding Enum: ${cursor.completeStringRepr()}');
+    _logger.fine(() => '++++ Adding Enum: ${cursor.completeStringRepr()}');
     _stack.top.enumClass = EnumClass(
       usr: enumUsr,
       dartDoc: getCursorDocComment(cursor),
       originalName: enumName,
       name: config.enumClassDecl.renameUsingConfig(enumName),
+      generateAsDartEnum: config.enumsAsDartEnums.shouldInclude(enumName),
     );
     _addEnumConstant(cursor);
   }
@@ -88,7 +89,7 @@ void _addEnumConstant(clang_types.CXCursor cursor) {
 int _enumCursorVisitor(clang_types.CXCursor cursor, clang_types.CXCursor parent,
     Pointer<Void> clientData) {
   try {
-    _logger.finest('  enumCursorVisitor: ${cursor.completeStringRepr()}');
+    _logger.finest(() => '  enumCursorVisitor: ${cursor.completeStringRepr()}');
     switch (clang.clang_getCursorKind(cursor)) {
       case clang_types.CXCursorKind.CXCursor_EnumConstantDecl:
         _addEnumConstantToEnumClass(cursor);
@@ -35,14 +35,14 @@ List<Func>? parseFunctionDeclaration(clang_types.CXCursor cursor) {
   final funcUsr = cursor.usr();
   final funcName = cursor.spelling();
   if (shouldIncludeFunc(funcUsr, funcName)) {
-    _logger.fine('++++ Adding Function: ${cursor.completeStringRepr()}');
+    _logger.fine(() => '++++ Adding Function: ${cursor.completeStringRepr()}');
 
     final rt = _getFunctionReturnType(cursor);
     final parameters = _getParameters(cursor, funcName);
     if (clang.clang_Cursor_isFunctionInlined(cursor) != 0 &&
         clang.clang_Cursor_getStorageClass(cursor) !=
             clang_types.CX_StorageClass.CX_SC_Extern) {
-      _logger.fine('---- Removed Function, reason: inline function: '
+      _logger.fine(() => '---- Removed Function, reason: inline function: '
           '${cursor.completeStringRepr()}');
       _logger.warning(
           "Skipped Function '$funcName', inline functions are not supported.");
@@ -51,7 +51,7 @@ List<Func>? parseFunctionDeclaration(clang_types.CXCursor cursor) {
     }
 
     if (rt.isIncompleteCompound || _stack.top.incompleteStructParameter) {
-      _logger.fine(
+      _logger.fine(() =>
           '---- Removed Function, reason: Incomplete struct pass/return by '
           'value: ${cursor.completeStringRepr()}');
       _logger.warning(
@@ -63,7 +63,8 @@ List<Func>? parseFunctionDeclaration(clang_types.CXCursor cursor) {
 
     if (rt.baseType is UnimplementedType ||
         _stack.top.unimplementedParameterType) {
-      _logger.fine('---- Removed Function, reason: unsupported return type or '
+      _logger.fine(() =>
+          '---- Removed Function, reason: unsupported return type or '
           'parameter type: ${cursor.completeStringRepr()}');
       _logger.warning(
           "Skipped Function '$funcName', function has unsupported return type "
@@ -89,6 +90,14 @@ List<Func>? parseFunctionDeclaration(clang_types.CXCursor cursor) {
             "Skipping variadic-argument config for function $funcName since its not variadic.");
       }
     }
+    var batchWrapper = config.batchWrapperFunctions.shouldInclude(funcName);
+    if (batchWrapper &&
+        !canBatch(FunctionType(returnType: rt, parameters: parameters))) {
+      _logger.warning("Skipping batch wrapper for function '$funcName', only "
+          'functions taking numbers and returning a number or void can be '
+          'batched.');
+      batchWrapper = false;
+    }
     for (final vaFunc in varArgFunctions) {
       _stack.top.funcs.add(Func(
         dartDoc: getCursorDocComment(
@@ -107,6 +116,10 @@ List<Func>? parseFunctionDeclaration(clang_types.CXCursor cursor) {
         exposeFunctionTypedefs:
             config.exposeFunctionTypedefs.shouldInclude(funcName),
         isLeaf: config.leafFunctions.shouldInclude(funcName),
+        stringWrapper: config.stringWrapperFunctions.shouldInclude(funcName),
+        stringLengthArguments:
+            config.stringLengthArguments.shouldInclude(funcName),
+        batchWrapper: batchWrapper && vaFunc.types.isEmpty,
         objCReturnsRetained: _stack.top.objCReturnsRetained,
         ffiNativeConfig: config.ffiNativeConfig,
       ));
@@ -130,13 +143,13 @@ List<Parameter> _getParameters(clang_types.CXCursor cursor, String funcName) {
   for (var i = 0; i < totalArgs; i++) {
     final paramCursor = clang.clang_Cursor_getArgument(cursor, i);
 
-    _logger.finer('===== parameter: ${paramCursor.completeStringRepr()}');
+    _logger.finer(() => '===== parameter: ${paramCursor.completeStringRepr()}');
 
     final pt = _getParameterType(paramCursor);
     if (pt.isIncompleteCompound) {
       _stack.top.incompleteStructParameter = true;
     } else if (pt.baseType is UnimplementedType) {
-      _logger.finer('Unimplemented type: ${pt.baseType}');
+      _logger.finer(() => 'Unimplemented type: ${pt.baseType}');
       _stack.top.unimplementedParameterType = true;
     }
 
@@ -15,6 +15,7 @@ import 'package:logging/logging.dart';
 import 'package:path/path.dart' as p;
 
 import '../clang_bindings/clang_bindings.dart' as clang_types;
+import '../compilation_database.dart';
 import '../utils.dart';
 
 final _logger = Logger('ffigen.header_parser.macro_parser');
@@ -25,27 +26,29 @@ Pointer<
                 clang_types.CXCursor, clang_types.CXCursor, Pointer<Void>)>>?
     _macroVariablevisitorPtr;
 
-/// Adds a macro definition to be parsed later.
-void saveMacroDefinition(clang_types.CXCursor cursor) {
+/// Adds a macro definition to be parsed later, with the compiler options of
+/// the header group at index [headerGroup].
+void saveMacroDefinition(clang_types.CXCursor cursor, [int headerGroup = 0]) {
   final macroUsr = cursor.usr();
   final originalMacroName = cursor.spelling();
   if (clang.clang_Cursor_isMacroBuiltin(cursor) == 0 &&
       clang.clang_Cursor_isMacroFunctionLike(cursor) == 0 &&
       shouldIncludeMacro(macroUsr, originalMacroName)) {
     // Parse macro only if it's not builtin or function-like.
-    _logger.fine(
+    _logger.fine(() =>
         "++++ Saved Macro '$originalMacroName' for later : ${cursor.completeStringRepr()}");
     final prefixedName = config.macroDecl.renameUsingConfig(originalMacroName);
     bindingsIndex.addMacroToSeen(macroUsr, prefixedName);
-    _saveMacro(prefixedName, macroUsr, originalMacroName);
+    _saveMacro(prefixedName, macroUsr, originalMacroName, headerGroup);
   }
 }
 
 /// Saves a macro to be parsed later.
 ///
 /// Macros are parsed later in [parseSavedMacros()].
-void _saveMacro(String name, String usr, String originalName) {
-  savedMacros[name] = Macro(usr, originalName);
+void _saveMacro(
+    String name, String usr, String originalName, int headerGroup) {
+  savedMacros[name] = Macro(usr, originalName, headerGroup);
 }
 
 List<Constant>? _bindings;
@@ -53,27 +56,53 @@ List<Constant>? _bindings;
 /// Macros cannot be parsed directly, so we create a new `.hpp` file in which
 /// they are assigned to a variable after which their value can be determined
 /// by evaluating the value of the variable.
-List<Constant>? parseSavedMacros() {
+///
+/// The macros of each of the [headerGroups] are evaluated separately, with
+/// the compiler options of that group, since they may depend on its defines
+/// and include paths.
+List<Constant>? parseSavedMacros(List<HeaderGroup> headerGroups) {
   _bindings = [];
 
   if (savedMacros.keys.isEmpty) {
     return _bindings;
   }
 
-  // Create a file for parsing macros;
-  final file = createFileForMacros();
-
   final index = clang.clang_createIndex(0, 0);
-  Pointer<Pointer<Utf8>> clangCmdArgs = nullptr;
-  var cmdLen = 0;
+  for (var i = 0; i < headerGroups.length; i++) {
+    final macroNames = [
+      for (final MapEntry(key: name, value: macro) in savedMacros.entries)
+        if (macro.headerGroup == i) name
+    ];
+    if (macroNames.isNotEmpty) {
+      _parseMacroGroup(index, headerGroups[i], macroNames);
+    }
+  }
+  clang.clang_disposeIndex(index);
+
+  // Keep the order in which the macros were found.
+  final macroOrder = {
+    for (final (i, name) in savedMacros.keys.indexed) name: i,
+  };
+  _bindings!.sort((a, b) => macroOrder[a.name]!.compareTo(macroOrder[b.name]!));
 
-  final compilerOpts = config.compilerOpts;
-  clangCmdArgs = createDynamicStringArray(compilerOpts);
+  return _bindings;
+}
+
+/// Evaluates the macros named [macroNames], which were found in the headers of
+/// [group].
+void _parseMacroGroup(clang_types.CXIndex index, HeaderGroup group,
+    List<String> macroNames) {
+  // Create a file for parsing macros;
+  final file = createFileForMacros(group.headers, macroNames);
 
-  cmdLen = config.compilerOpts.length;
+  // Add the user options last so they can override the group's options.
+  final compilerOpts = [...group.compilerOpts, ...config.compilerOpts];
+  final clangCmdArgs = createDynamicStringArray(compilerOpts);
+  final cmdLen = compilerOpts.length;
+  final filePathPtr = file.path.toNativeUtf8();
   final tu = clang.clang_parseTranslationUnit(
     index,
-    file.path.toNativeUtf8().cast(),
+    filePathPtr.cast(),
     clangCmdArgs.cast(),
     cmdLen,
     nullptr,
@@ -98,11 +127,10 @@ List<Constant>? parseSavedMacros() {
   }
 
   clang.clang_disposeTranslationUnit(tu);
-  clang.clang_disposeIndex(index);
+  calloc.free(filePathPtr);
+  clangCmdArgs.dispose(cmdLen);
   // Delete the temp file created for macros.
   file.deleteSync();
-
-  return _bindings;
 }
 
 /// Child visitor invoked on translationUnitCursor for parsing macroVariables.
@@ -115,7 +143,8 @@ int _macroVariablevisitor(clang_types.CXCursor cursor,
         cursor.kind == clang_types.CXCursorKind.CXCursor_VarDecl) {
       final e = clang.clang_Cursor_Evaluate(cursor);
       final k = clang.clang_EvalResult_getKind(e);
-      _logger.fine('macroVariablevisitor: ${cursor.completeStringRepr()}');
+      _logger.fine(
+          () => 'macroVariablevisitor: ${cursor.completeStringRepr()}');
 
       /// Get macro name, the variable name starts with '<macro-name>_'.
       final macroName = MacroVariableString.decode(cursor.spelling());
@@ -181,8 +210,9 @@ String? _generatedFileBaseName;
 /// Used to determine if macro should be included in bindings or not.
 late Set<String> _macroVarNames;
 
-/// Creates a temporary file for parsing macros in current directory.
-File createFileForMacros() {
+/// Creates a temporary file for parsing the macros named [macroNames], found
+/// in [headers].
+File createFileForMacros(List<String> headers, List<String> macroNames) {
   final fileNameBase = p.join(strings.tmpDir, 'temp_for_macros');
   final fileExt = 'hpp';
 
@@ -202,13 +232,13 @@ File createFileForMacros() {
 
   // Write file contents.
   final sb = StringBuffer();
-  for (final h in config.headers.entryPoints) {
+  for (final h in headers) {
     final fullHeaderPath = File(h).absolute.path;
     sb.writeln('#include "$fullHeaderPath"');
   }
 
   _macroVarNames = {};
-  for (final prefixedMacroName in savedMacros.keys) {
+  for (final prefixedMacroName in macroNames) {
     // Write macro.
     final macroVarName = MacroVariableString.encode(prefixedMacroName);
     sb.writeln(
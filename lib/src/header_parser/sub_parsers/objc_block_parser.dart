@@ -27,7 +27,7 @@ ObjCBlock parseObjCBlock(clang_types.CXType cxtype) {
     usr += ' ${type.cacheKey()}';
   }
 
-  _logger.fine('++++ Adding ObjC block: '
+  _logger.fine(() => '++++ Adding ObjC block: '
       '${cxtype.completeStringRepr()}, syntheticUsr: $usr');
 
   return ObjCBlock(
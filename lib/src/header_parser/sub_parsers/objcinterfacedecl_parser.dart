@@ -5,11 +5,13 @@
 import 'dart:ffi';
 
 import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/config_provider/config_types.dart';
 import 'package:ffigen/src/header_parser/data.dart';
 import 'package:logging/logging.dart';
 
 import '../clang_bindings/clang_bindings.dart' as clang_types;
 import '../includer.dart';
+import '../translation_unit_parser.dart' show addToBindings;
 import '../utils.dart';
 
 final _logger = Logger('ffigen.header_parser.objcinterfacedecl_parser');
@@ -64,7 +66,13 @@ Type? parseObjCInterfaceDeclaration(
   final t = cursor.type();
   final name = t.spelling();
 
-  _logger.fine('++++ Adding ObjC interface: '
+  // Interfaces which are only a dependency are generated as stubs, if the user
+  // has specified `dependency-only` as opaque.
+  final isStub = ignoreFilter &&
+      config.objcInterfaceDependencies == CompoundDependencies.opaque &&
+      !config.objcInterfaces.shouldInclude(itfName, config.excludeAllByDefault);
+
+  _logger.fine(() => '++++ Adding ObjC interface${isStub ? ' stub' : ''}: '
       'Name: $name, ${cursor.completeStringRepr()}');
 
   return ObjCInterface(
@@ -74,6 +82,7 @@ Type? parseObjCInterfaceDeclaration(
     lookupName: config.objcModulePrefixer.applyPrefix(name),
     dartDoc: getCursorDocComment(cursor),
     builtInFunctions: objCBuiltInFunctions,
+    isStub: isStub,
   );
 }
 
@@ -88,7 +97,7 @@ void fillObjCInterfaceMethodsIfNeeded(
   if (itf.filled) return;
   itf.filled = true; // Break cycles.
 
-  _logger.fine('++++ Filling ObjC interface: '
+  _logger.fine(() => '++++ Filling ObjC interface: '
       'Name: ${itf.originalName}, ${cursor.completeStringRepr()}');
 
   _interfaceStack.push(_ParsedObjCInterface(itf));
@@ -99,7 +108,7 @@ void fillObjCInterfaceMethodsIfNeeded(
       nullptr);
   _interfaceStack.pop();
 
-  _logger.fine('++++ Finished ObjC interface: '
+  _logger.fine(() => '++++ Finished ObjC interface: '
       'Name: ${itf.originalName}, ${cursor.completeStringRepr()}');
 }
 
@@ -126,6 +135,11 @@ int _isClassDeclarationVisitor(clang_types.CXCursor cursor,
 
 int _parseInterfaceVisitor(clang_types.CXCursor cursor,
     clang_types.CXCursor parent, Pointer<Void> clientData) {
+  // Stubs only need their super type, skip parsing their members.
+  if (_interfaceStack.top.interface.isStub &&
+      cursor.kind != clang_types.CXCursorKind.CXCursor_ObjCSuperClassRef) {
+    return clang_types.CXChildVisitResult.CXChildVisit_Continue;
+  }
   switch (cursor.kind) {
     case clang_types.CXCursorKind.CXCursor_ObjCSuperClassRef:
       _parseSuperType(cursor);
@@ -143,11 +157,26 @@ int _parseInterfaceVisitor(clang_types.CXCursor cursor,
 
 void _parseSuperType(clang_types.CXCursor cursor) {
   final superType = cursor.type().toCodeGenType();
-  _logger.fine('       > Super type: '
+  _logger.fine(() => '       > Super type: '
       '$superType ${cursor.completeStringRepr()}');
   final itf = _interfaceStack.top.interface;
   if (superType is ObjCInterface) {
     itf.superType = superType;
+    if (!itf.isStub && superType.isStub) {
+      // Fully parsed interfaces inherit methods from their super types, such
+      // as the NSObject constructors, so the super type can't be a stub.
+      _logger.fine(() => '       > Filling stub super type: $superType');
+      superType.isStub = false;
+      superType.filled = false;
+      fillObjCInterfaceMethodsIfNeeded(
+          superType, clang.clang_getTypeDeclaration(cursor.type()));
+
+      // Categories declared before the promotion were skipped.
+      final categories = skippedObjCCategories.remove(superType.usr);
+      for (final category in categories ?? const <clang_types.CXCursor>[]) {
+        addToBindings(parseObjCCategoryDeclaration(category));
+      }
+    }
   } else {
     _logger.severe(
         'Super type of $itf is $superType, which is not a valid interface.');
@@ -178,7 +207,7 @@ void _parseProperty(clang_types.CXCursor cursor) {
 
   final property = ObjCProperty(fieldName);
 
-  _logger.fine('       > Property: '
+  _logger.fine(() => '       > Property: '
       '$fieldType $fieldName ${cursor.completeStringRepr()}');
 
   final getterName =
@@ -228,7 +257,7 @@ void _parseMethod(clang_types.CXCursor cursor) {
     returnType: returnType,
   );
   final parsed = _ParsedObjCMethod(method);
-  _logger.fine('       > ${isClassMethod ? 'Class' : 'Instance'} method: '
+  _logger.fine(() => '       > ${isClassMethod ? 'Class' : 'Instance'} method: '
       '${method.originalName} ${cursor.completeStringRepr()}');
   _methodStack.push(parsed);
   clang.clang_visitChildren(
@@ -269,7 +298,7 @@ void _parseMethodParam(clang_types.CXCursor cursor) {
         'parameter type: $type.');
     return;
   }
-  _logger.fine(
+  _logger.fine(() =>
       '           >> Parameter: $type $name ${cursor.completeStringRepr()}');
   parsed.method.params.add(ObjCMethodParam(type, name));
 }
@@ -287,7 +316,7 @@ BindingType? parseObjCCategoryDeclaration(clang_types.CXCursor cursor) {
   // interface is a different kind of node to the interface's super type (so is
   // ignored by _parseInterfaceVisitor).
   final name = cursor.spelling();
-  _logger.fine('++++ Adding ObjC category: '
+  _logger.fine(() => '++++ Adding ObjC category: '
       'Name: $name, ${cursor.completeStringRepr()}');
 
   _findCategoryInterfaceVisitorResult = null;
@@ -310,6 +339,14 @@ BindingType? parseObjCCategoryDeclaration(clang_types.CXCursor cursor) {
     return null;
   }
 
+  if (itf.isStub) {
+    // Parsed again if the interface is promoted to a full interface later.
+    _logger.fine(() => '---- Skipped ObjC category $name of stub interface '
+        '${itf.originalName}.');
+    skippedObjCCategories.putIfAbsent(itf.usr, () => []).add(cursor);
+    return null;
+  }
+
   _interfaceStack.push(_ParsedObjCInterface(itf));
   clang.clang_visitChildren(
       cursor,
@@ -318,7 +355,7 @@ BindingType? parseObjCCategoryDeclaration(clang_types.CXCursor cursor) {
       nullptr);
   _interfaceStack.pop();
 
-  _logger.fine('++++ Finished ObjC category: '
+  _logger.fine(() => '++++ Finished ObjC category: '
       'Name: $name, ${cursor.completeStringRepr()}');
 
   return itf;
@@ -46,29 +46,30 @@ Typealias? parseTypedefDeclaration(
     if (bindingsIndex.isSeenUnsupportedTypealias(typedefUsr)) {
       // Do not process unsupported typealiases again.
     } else if (s is UnimplementedType) {
-      _logger.fine("Skipped Typedef '$typedefName': "
+      _logger.fine(() => "Skipped Typedef '$typedefName': "
           'Unimplemented type referred.');
       bindingsIndex.addUnsupportedTypealiasToSeen(typedefUsr);
     } else if (s is Compound && s.originalName == typedefName) {
       // Ignore typedef if it refers to a compound with the same original name.
       bindingsIndex.addUnsupportedTypealiasToSeen(typedefUsr);
-      _logger.fine("Skipped Typedef '$typedefName': "
+      _logger.fine(() => "Skipped Typedef '$typedefName': "
           'Name matches with referred struct/union.');
     } else if (s is EnumClass) {
       // Ignore typedefs to Enum.
       bindingsIndex.addUnsupportedTypealiasToSeen(typedefUsr);
-      _logger.fine("Skipped Typedef '$typedefName': typedef to enum.");
+      _logger.fine(() => "Skipped Typedef '$typedefName': typedef to enum.");
     } else if (s is HandleType) {
       // Ignore typedefs to Handle.
-      _logger.fine("Skipped Typedef '$typedefName': typedef to Dart Handle.");
+      _logger.fine(
+          () => "Skipped Typedef '$typedefName': typedef to Dart Handle.");
       bindingsIndex.addUnsupportedTypealiasToSeen(typedefUsr);
     } else if (s is ConstantArray || s is IncompleteArray) {
       // Ignore typedefs to Constant Array.
-      _logger.fine("Skipped Typedef '$typedefName': typedef to array.");
+      _logger.fine(() => "Skipped Typedef '$typedefName': typedef to array.");
       bindingsIndex.addUnsupportedTypealiasToSeen(typedefUsr);
     } else if (s is BooleanType) {
       // Ignore typedefs to Boolean.
-      _logger.fine("Skipped Typedef '$typedefName': typedef to bool.");
+      _logger.fine(() => "Skipped Typedef '$typedefName': typedef to bool.");
       bindingsIndex.addUnsupportedTypealiasToSeen(typedefUsr);
     } else {
       // Create typealias.
@@ -39,8 +39,8 @@ void saveUnNamedEnum(clang_types.CXCursor cursor) {
 int _unnamedenumCursorVisitor(clang_types.CXCursor cursor,
     clang_types.CXCursor parent, Pointer<Void> clientData) {
   try {
-    _logger
-        .finest('  unnamedenumCursorVisitor: ${cursor.completeStringRepr()}');
+    _logger.finest(
+        () => '  unnamedenumCursorVisitor: ${cursor.completeStringRepr()}');
     switch (clang.clang_getCursorKind(cursor)) {
       case clang_types.CXCursorKind.CXCursor_EnumConstantDecl:
         if (shouldIncludeUnnamedEnumConstant(cursor.usr(), cursor.spelling())) {
@@ -63,7 +63,7 @@ int _unnamedenumCursorVisitor(clang_types.CXCursor cursor,
 
 /// Adds the parameter to func in [functiondecl_parser.dart].
 void _addUnNamedEnumConstant(clang_types.CXCursor cursor) {
-  _logger.fine(
+  _logger.fine(() =>
       '++++ Adding Constant from unnamed enum: ${cursor.completeStringRepr()}');
   final constant = Constant(
     usr: cursor.usr(),
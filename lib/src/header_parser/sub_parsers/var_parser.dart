@@ -23,11 +23,11 @@ Global? parseVarDeclaration(clang_types.CXCursor cursor) {
     return null;
   }
 
-  _logger.fine('++++ Adding Global: ${cursor.completeStringRepr()}');
+  _logger.fine(() => '++++ Adding Global: ${cursor.completeStringRepr()}');
 
   final type = cursor.type().toCodeGenType();
   if (type.baseType is UnimplementedType) {
-    _logger.fine('---- Removed Global, reason: unsupported type: '
+    _logger.fine(() => '---- Removed Global, reason: unsupported type: '
         '${cursor.completeStringRepr()}');
     _logger.warning("Skipped global variable '$name', type not supported.");
     return null;
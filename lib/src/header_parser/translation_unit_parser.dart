@@ -20,6 +20,7 @@ import 'utils.dart';
 final _logger = Logger('ffigen.header_parser.translation_unit_parser');
 
 late Set<Binding> _bindings;
+late int _headerGroup;
 
 Pointer<
         NativeFunction<
@@ -34,8 +35,13 @@ Pointer<
     _cursorDefinitionVisitorPtr;
 
 /// Parses the translation unit and returns the generated bindings.
-Set<Binding> parseTranslationUnit(clang_types.CXCursor translationUnitCursor) {
+///
+/// Macros are saved along with [headerGroup], the index of the header group
+/// the translation unit was parsed from.
+Set<Binding> parseTranslationUnit(clang_types.CXCursor translationUnitCursor,
+    {int headerGroup = 0}) {
   _bindings = {};
+  _headerGroup = headerGroup;
   final resultCode = clang.clang_visitChildren(
     translationUnitCursor,
     _rootCursorVisitorPtr ??=
@@ -53,7 +59,7 @@ int _rootCursorVisitor(clang_types.CXCursor cursor, clang_types.CXCursor parent,
     Pointer<Void> clientData) {
   try {
     if (shouldIncludeRootCursor(cursor.sourceFileName())) {
-      _logger.finest('rootCursorVisitor: ${cursor.completeStringRepr()}');
+      _logger.finest(() => 'rootCursorVisitor: ${cursor.completeStringRepr()}');
       switch (clang.clang_getCursorKind(cursor)) {
         case clang_types.CXCursorKind.CXCursor_FunctionDecl:
           addAllToBindings(parseFunctionDeclaration(cursor) as List<Binding>);
@@ -62,13 +68,17 @@ int _rootCursorVisitor(clang_types.CXCursor cursor, clang_types.CXCursor parent,
         case clang_types.CXCursorKind.CXCursor_UnionDecl:
         case clang_types.CXCursorKind.CXCursor_EnumDecl:
         case clang_types.CXCursorKind.CXCursor_ObjCInterfaceDecl:
+          if (_isUnusedRootTypeDecl(cursor)) {
+            _logger.finest('rootCursorVisitor: not in usage manifest');
+            break;
+          }
           addToBindings(_getCodeGenTypeFromCursor(cursor));
           break;
         case clang_types.CXCursorKind.CXCursor_ObjCCategoryDecl:
           addToBindings(parseObjCCategoryDeclaration(cursor));
           break;
         case clang_types.CXCursorKind.CXCursor_MacroDefinition:
-          saveMacroDefinition(cursor);
+          saveMacroDefinition(cursor, _headerGroup);
           break;
         case clang_types.CXCursorKind.CXCursor_VarDecl:
           addToBindings(parseVarDeclaration(cursor));
@@ -77,7 +87,7 @@ int _rootCursorVisitor(clang_types.CXCursor cursor, clang_types.CXCursor parent,
           _logger.finer('rootCursorVisitor: CursorKind not implemented');
       }
     } else {
-      _logger.finest(
+      _logger.finest(() =>
           'rootCursorVisitor:(not included) ${cursor.completeStringRepr()}');
     }
   } catch (e, s) {
@@ -104,12 +114,37 @@ void addAllToBindings(List<Binding> b) {
   }
 }
 
+/// True if [cursor] is a named type declaration which isn't referred to by the
+/// usage manifest, checked before extracting its type.
+bool _isUnusedRootTypeDecl(clang_types.CXCursor cursor) {
+  if (config.usageManifest == null ||
+      clang.clang_Cursor_isAnonymous(cursor) != 0) {
+    return false;
+  }
+  // Names are extracted the same way as in the respective sub parsers.
+  switch (cursor.kind) {
+    case clang_types.CXCursorKind.CXCursor_StructDecl:
+      return isUnusedRootDecl(cursor.usr().split('@').last, config.structDecl);
+    case clang_types.CXCursorKind.CXCursor_UnionDecl:
+      return isUnusedRootDecl(cursor.usr().split('@').last, config.unionDecl);
+    case clang_types.CXCursorKind.CXCursor_EnumDecl:
+      return isUnusedRootDecl(
+          cursor.usr().split('@').last, config.enumClassDecl);
+    case clang_types.CXCursorKind.CXCursor_ObjCInterfaceDecl:
+      return isUnusedRootDecl(cursor.spelling(), config.objcInterfaces);
+  }
+  return false;
+}
+
 BindingType? _getCodeGenTypeFromCursor(clang_types.CXCursor cursor) {
   final t = getCodeGenType(cursor.type(), ignoreFilter: false);
   return t is BindingType ? t : null;
 }
 
 /// Visits all cursors and builds a map of usr and [CXCursor].
+///
+/// If a declaration IR is written, the locations of the declarations are
+/// saved as well.
 void buildUsrCursorDefinitionMap(clang_types.CXCursor translationUnitCursor) {
   _bindings = {};
   final resultCode = clang.clang_visitChildren(
@@ -127,6 +162,16 @@ int _definitionCursorVisitor(clang_types.CXCursor cursor,
     clang_types.CXCursor parent, Pointer<Void> clientData) {
   try {
     cursorIndex.saveDefinition(cursor);
+    if (config.irOutput != null) {
+      final usr = cursor.usr();
+      if (usr.isNotEmpty && !declarationLocations.containsKey(usr)) {
+        // Prefer the location of the definition over forward declarations.
+        final definition = clang.clang_getCursorDefinition(cursor);
+        declarationLocations[usr] = clang.clang_Cursor_isNull(definition) == 0
+            ? definition.sourceLocation()
+            : cursor.sourceLocation();
+      }
+    }
   } catch (e, s) {
     _logger.severe(e);
     _logger.severe(s);
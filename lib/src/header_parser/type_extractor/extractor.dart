@@ -38,7 +38,8 @@ Type getCodeGenType(
   /// parameter names in function types.
   clang_types.CXCursor? originalCursor,
 }) {
-  _logger.fine('${_padding}getCodeGenType ${cxtype.completeStringRepr()}');
+  _logger.fine(
+      () => '${_padding}getCodeGenType ${cxtype.completeStringRepr()}');
 
   // Special case: Elaborated types just refer to another type.
   if (cxtype.kind == clang_types.CXTypeKind.CXType_Elaborated) {
@@ -109,7 +110,10 @@ Type getCodeGenType(
           s.usr == strings.dartHandleUsr) {
         return HandleType();
       }
-      return PointerType(s);
+      // Look through typedefs, so that `const` added by them is found too.
+      final canonicalPointee = clang.clang_getCanonicalType(pt);
+      final isConst = clang.clang_isConstQualifiedType(canonicalPointee) != 0;
+      return PointerType(s, isConst: isConst);
     case clang_types.CXTypeKind.CXType_FunctionProto:
       // Primarily used for function pointers.
       return _extractFromFunctionProto(cxtype, cursor: originalCursor);
@@ -151,12 +155,13 @@ Type getCodeGenType(
         typeSpellKey = typeSpellKey.replaceFirst('const ', '');
       }
       if (config.nativeTypeMappings.containsKey(typeSpellKey)) {
-        _logger.fine('  Type $typeSpellKey mapped from type-map.');
+        _logger.fine(() => '  Type $typeSpellKey mapped from type-map.');
         return config.nativeTypeMappings[typeSpellKey]!;
       } else if (cxTypeKindToImportedTypes.containsKey(typeSpellKey)) {
         return cxTypeKindToImportedTypes[typeSpellKey]!;
       } else {
-        _logger.fine('typedeclarationCursorVisitor: getCodeGenType: Type Not '
+        _logger.fine(() =>
+            'typedeclarationCursorVisitor: getCodeGenType: Type Not '
             'Implemented, ${cxtype.completeStringRepr()}');
         return UnimplementedType('${cxtype.kindSpelling()} not implemented');
       }
@@ -201,12 +206,12 @@ _CreateTypeFromCursorResult _createTypeFromCursor(clang_types.CXType cxtype,
       }
       final usr = cursor.usr();
       if (config.typedefTypeMappings.containsKey(spelling)) {
-        _logger.fine('  Type $spelling mapped from type-map');
+        _logger.fine(() => '  Type $spelling mapped from type-map');
         return _CreateTypeFromCursorResult(
             config.typedefTypeMappings[spelling]!);
       }
       if (config.usrTypeMappings.containsKey(usr)) {
-        _logger.fine('  Type $spelling mapped from usr');
+        _logger.fine(() => '  Type $spelling mapped from usr');
         return _CreateTypeFromCursorResult(config.usrTypeMappings[usr]!);
       }
       // Get name from supported typedef name if config allows.
@@ -273,7 +278,8 @@ void _fillFromCursorIfNeeded(Type? type, clang_types.CXCursor cursor,
 
 Type? _extractfromRecord(clang_types.CXType cxtype, clang_types.CXCursor cursor,
     bool ignoreFilter, bool pointerReference) {
-  _logger.fine('${_padding}_extractfromRecord: ${cursor.completeStringRepr()}');
+  _logger.fine(
+      () => '${_padding}_extractfromRecord: ${cursor.completeStringRepr()}');
 
   final cursorKind = clang.clang_getCursorKind(cursor);
   if (cursorKind == clang_types.CXCursorKind.CXCursor_StructDecl ||
@@ -315,7 +321,7 @@ Type? _extractfromRecord(clang_types.CXType cxtype, clang_types.CXCursor cursor,
       return struct;
     }
   }
-  _logger.fine('typedeclarationCursorVisitor: _extractfromRecord: '
+  _logger.fine(() => 'typedeclarationCursorVisitor: _extractfromRecord: '
       'Not Implemented, ${cursor.completeStringRepr()}');
   return UnimplementedType('${cxtype.kindSpelling()} not implemented');
 }
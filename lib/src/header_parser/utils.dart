@@ -7,6 +7,7 @@ import 'dart:ffi';
 import 'package:ffi/ffi.dart';
 import 'package:ffigen/src/code_generator.dart';
 import 'package:ffigen/src/config_provider/config_types.dart';
+import 'package:ffigen/src/declaration_ir.dart' show SourceLocation;
 import 'package:logging/logging.dart';
 
 import 'clang_bindings/clang_bindings.dart' as clang_types;
@@ -128,6 +129,26 @@ extension CXCursorExt on clang_types.CXCursor {
     return s;
   }
 
+  /// Returns the file, line and column of the cursor.
+  SourceLocation sourceLocation() {
+    final cxsource = clang.clang_getCursorLocation(this);
+    final cxfilePtr = calloc<Pointer<Void>>();
+    final line = calloc<UnsignedInt>();
+    final column = calloc<UnsignedInt>();
+
+    // Puts the values in these pointers.
+    clang.clang_getFileLocation(cxsource, cxfilePtr, line, column, nullptr);
+    final location = SourceLocation(
+        clang.clang_getFileName(cxfilePtr.value).toStringAndDispose(),
+        line.value,
+        column.value);
+
+    calloc.free(cxfilePtr);
+    calloc.free(line);
+    calloc.free(column);
+    return location;
+  }
+
   int sourceFileOffset() {
     final cxsource = clang.clang_getCursorLocation(this);
     final cxOffset = calloc<UnsignedInt>();
@@ -291,6 +312,11 @@ extension CXTypeExt on clang_types.CXType {
     return clang.clang_Type_getAlignOf(this);
   }
 
+  /// Size of the type in bytes, or a [clang_types.CXTypeLayoutError] value.
+  int size() {
+    return clang.clang_Type_getSizeOf(this);
+  }
+
   /// For debugging: returns [spelling] [kind] [kindSpelling].
   String completeStringRepr() {
     final s =
@@ -371,7 +397,11 @@ class Macro {
   final String usr;
   final String? originalName;
 
-  Macro(this.usr, this.originalName);
+  /// Index of the header group the macro was found in. The macro is evaluated
+  /// with the compiler options of this group.
+  final int headerGroup;
+
+  Macro(this.usr, this.originalName, [this.headerGroup = 0]);
 }
 
 /// Tracks if a binding is 'seen' or not.
@@ -452,7 +482,7 @@ class CursorIndex {
           if (clang.clang_Cursor_isNull(cursorDefinition) == 0) {
             _usrCursorDefinition[usr] = cursorDefinition;
           } else {
-            _logger.finest(
+            _logger.finest(() =>
                 "Missing cursor definition in current translation unit: ${cursor.completeStringRepr()}");
           }
         }
@@ -32,6 +32,8 @@ const output = 'output';
 // Sub-keys of output.
 const bindings = "bindings";
 const symbolFile = 'symbol-file';
+const ir = 'ir';
+const batchCSource = 'batch-c-source';
 
 const language = 'language';
 
@@ -56,6 +58,8 @@ const includeDirectives = 'include-directives';
 
 const compilerOpts = 'compiler-opts';
 
+const compilationDatabase = 'compilation-database';
+
 const compilerOptsAuto = 'compiler-opts-automatic';
 // Sub-fields of compilerOptsAuto.
 const macos = 'macos';
@@ -68,6 +72,7 @@ const structs = 'structs';
 const unions = 'unions';
 const enums = 'enums';
 const unnamedEnums = 'unnamed-enums';
+const enumsAsDartEnums = 'as-dart-enums';
 const globals = 'globals';
 const macros = 'macros';
 const typedefs = 'typedefs';
@@ -85,6 +90,9 @@ const symbolAddress = 'symbol-address';
 // Nested under `functions`
 const exposeFunctionTypedefs = 'expose-typedefs';
 const leafFunctions = 'leaf';
+const stringWrappers = 'string-wrappers';
+const stringLengthArguments = 'string-length-arguments';
+const batchWrappers = 'batch-wrappers';
 const varArgFunctions = 'variadic-arguments';
 
 // Nested under varArg entries
@@ -93,6 +101,7 @@ const types = "types";
 
 // Sub-fields of ObjC interfaces.
 const objcModule = 'module';
+const objcBorrowedViews = 'borrowed-views';
 
 const dependencyOnly = 'dependency-only';
 // Values for `compoundDependencies`.
@@ -152,6 +161,16 @@ const formatVersion = "format_version";
 /// symbol file, this version is compared according to `semantic` versioning
 /// to determine compatibility.
 const symbolFileFormatVersion = "1.0.0";
+
+// Declaration IR json.
+const irDeclarations = 'declarations';
+
+/// Prefix of the C functions generated for `batch-wrappers`.
+const batchShimPrefix = 'ffigen_batch_';
+
+/// Current declaration IR format version, compared like
+/// [symbolFileFormatVersion] when reading an IR file.
+const irFormatVersion = '1.0.0';
 const files = "files";
 const usedConfig = "used-config";
 
@@ -165,7 +184,8 @@ const importPath = 'import-path';
 
 final predefinedLibraryImports = {
   ffiImport.name: ffiImport,
-  ffiPkgImport.name: ffiPkgImport
+  ffiPkgImport.name: ffiPkgImport,
+  typedDataImport.name: typedDataImport,
 };
 
 const typeMap = 'type-map';
@@ -200,6 +220,7 @@ const supportedNativeType_mappings = <String, SupportedNativeType>{
 const sort = 'sort';
 const useSupportedTypedefs = 'use-supported-typedefs';
 const useDartHandle = 'use-dart-handle';
+const sharedSymbolTable = 'shared-symbol-table';
 
 const comments = 'comments';
 // Sub-fields of comments.
@@ -265,6 +286,19 @@ const dartHandleUsr = 'c:@S@_Dart_Handle';
 const ffiNative = 'ffi-native';
 const ffiNativeAsset = 'assetId';
 
+const compoundLayout = 'compound-layout';
+const compoundLayoutTables = 'tables';
+const compoundLayoutVerify = 'verify';
+const compoundLayoutOffsetAccessors = 'offset-accessors';
+
+const usageManifest = 'usage-manifest';
+const usageManifestFiles = 'files';
+const usageManifestDartSources = 'dart-sources';
+
+const finalizableHandles = 'finalizable-handles';
+const finalizableHandleDestructor = 'destructor';
+const finalizableHandleSize = 'size';
+
 Directory? _tmpDir;
 
 /// A path to a unique temporary directory that should be used for files meant
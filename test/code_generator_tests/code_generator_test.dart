@@ -305,6 +305,37 @@ void main() {
       );
       _matchLib(library, 'enumclass');
     });
+    test('enum_class as Dart enum', () {
+      final library = Library(
+        name: 'Bindings',
+        header: '// ignore_for_file: unused_import\n',
+        bindings: [
+          EnumClass(
+            name: 'Status',
+            dartDoc: 'Dense values.',
+            generateAsDartEnum: true,
+            enumConstants: [
+              EnumConstant(name: 'error', value: -1, dartDoc: 'negative'),
+              EnumConstant(name: 'ok', value: 0),
+              EnumConstant(name: 'retry', value: 2),
+              EnumConstant(name: 'success', value: 0, dartDoc: 'Same as ok.'),
+              EnumConstant(name: 'value', value: 3),
+            ],
+          ),
+          EnumClass(
+            name: 'Signal',
+            dartDoc: 'Sparse values.',
+            generateAsDartEnum: true,
+            enumConstants: [
+              EnumConstant(name: 'a', value: 1),
+              EnumConstant(name: 'b', value: 100),
+              EnumConstant(name: 'c', value: 10000),
+            ],
+          ),
+        ],
+      );
+      _matchLib(library, 'dart_enum');
+    });
     test('Internal conflict resolution', () {
       final library = Library(
         name: 'init_dylib',
@@ -478,6 +509,109 @@ void main() {
     );
     _matchLib(library, 'typealias');
   });
+  test('Shared symbol table', () {
+    final library = Library(
+      name: 'Bindings',
+      sharedSymbolTable: true,
+      bindings: [
+        Func(
+          name: 'add',
+          parameters: [
+            Parameter(name: 'a', type: NativeType(SupportedNativeType.Int32)),
+          ],
+          returnType: NativeType(SupportedNativeType.Int32),
+        ),
+        Global(name: 'counter', type: NativeType(SupportedNativeType.Int32)),
+      ],
+    );
+    _matchLib(library, 'shared_symbol_table');
+  });
+  test('Finalizable handle', () {
+    final db = Struct(name: 'Db');
+    final dbFree = Func(
+      name: 'db_free',
+      parameters: [Parameter(name: 'db', type: PointerType(db))],
+      returnType: NativeType(SupportedNativeType.Void),
+    );
+    final dbSize = Func(
+      name: 'db_size',
+      parameters: [Parameter(name: 'db', type: PointerType(db))],
+      returnType: sizeType,
+    );
+    final library = Library(
+      name: 'Bindings',
+      bindings: [
+        dbFree,
+        dbSize,
+        FinalizableHandle(compound: db, destructor: dbFree, size: dbSize),
+      ],
+    );
+    _matchLib(library, 'finalizable_handle');
+  });
+  test('Parallel rendering matches serial rendering', () async {
+    // Func `fN` generates `_fNPtr`, which conflicts with the `_fNPtr`
+    // generated by Func `fNPtr`. The pairs are far apart, so that they end up
+    // in different slices.
+    Library makeLibrary() => Library(
+          name: 'Bindings',
+          bindings: [
+            for (var i = 0; i < 20; i++)
+              Func(
+                name: 'f$i',
+                parameters: [Parameter(name: 'a', type: intType)],
+                returnType: NativeType(SupportedNativeType.Void),
+                exposeSymbolAddress: i.isEven,
+              ),
+            for (var i = 0; i < 20; i++) ...[
+              Struct(
+                  name: 'S$i',
+                  members: [Member(name: 'a', type: PointerType(intType))]),
+              Global(name: 'g$i', type: intType),
+            ],
+            for (var i = 0; i < 20; i += 3)
+              Func(
+                name: 'f${i}Ptr',
+                returnType: NativeType(SupportedNativeType.Void),
+              ),
+          ],
+        );
+
+    final serial = makeLibrary().generate();
+    for (final jobs in [2, 3, 8]) {
+      expect(await makeLibrary().generateInParallel(jobs: jobs), serial);
+    }
+    expect(serial, contains('_f3Ptr1'));
+  });
+  test('Parallel rendering resolves names read across bindings', () async {
+    // The typedef exposed by `f` is renamed to `DartF1` because of the struct
+    // `DartF`. `f` reads the name, but is rendered in another binding list.
+    Library makeLibrary() => Library(
+          name: 'Bindings',
+          bindings: [
+            Func(
+              name: 'f',
+              returnType: NativeType(SupportedNativeType.Void),
+              exposeFunctionTypedefs: true,
+            ),
+            Struct(name: 'DartF'),
+            for (var i = 0; i < 10; i++)
+              Struct(
+                name: 'S$i',
+                members: [Member(name: 'a', type: intType)],
+                generateLayoutTable: true,
+              )..size = 4,
+          ],
+          verifyCompoundLayouts: true,
+        );
+
+    final serial = makeLibrary().generate();
+    for (final jobs in [2, 3, 8]) {
+      expect(await makeLibrary().generateInParallel(jobs: jobs), serial);
+    }
+    expect(serial, contains('typedef DartF1 ='));
+    expect(serial, contains('asFunction<DartF1>'));
+    expect(serial, contains('S9.sizeOf'));
+  });
 }
 
 /// Utility to match expected bindings to the generated bindings.
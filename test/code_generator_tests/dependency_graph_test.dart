@@ -0,0 +1,147 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:test/test.dart';
+
+/// Bindings for `void f(A *a)`, where `struct A { struct B b; }`, and
+/// `struct B { int x; }`. If [withC] is true, B also has a member of type
+/// `struct C *`.
+List<Binding> _bindings({bool withC = false}) {
+  final b = Struct(usr: 'c:@S@B', name: 'B', members: [
+    Member(name: 'x', type: intType),
+    if (withC)
+      Member(name: 'c', type: PointerType(Struct(usr: 'c:@S@C', name: 'C'))),
+  ]);
+  final a = Struct(usr: 'c:@S@A', name: 'A', members: [
+    Member(name: 'b', type: b),
+  ]);
+  return [
+    Func(
+      usr: 'c:@F@f',
+      name: 'f',
+      returnType: voidType,
+      parameters: [Parameter(name: 'a', type: PointerType(a))],
+    ),
+  ];
+}
+
+/// Bindings with names which are resolved when they're written: a function
+/// with two parameters named `a`, and the typedef exposed for it, whose Dart
+/// alias `DartG` conflicts with a struct.
+List<Binding> _renderedNameBindings() => [
+      Func(
+        usr: 'c:@F@g',
+        name: 'g',
+        returnType: voidType,
+        parameters: [
+          Parameter(name: 'a', type: intType),
+          Parameter(name: 'a', type: intType),
+        ],
+        exposeFunctionTypedefs: true,
+      ),
+      Struct(usr: 'c:@S@DartG', name: 'DartG'),
+    ];
+
+/// Removes the first parameter of the function in [bindings], and the struct.
+List<Binding> _withoutConflicts(List<Binding> bindings) {
+  final g = bindings.first as Func;
+  g.functionType.parameters.removeAt(0);
+  return [g];
+}
+
+String _generate(List<Binding> bindings, [DependencyGraph? graph]) =>
+    Library(name: 'Bindings', bindings: bindings, dependencyGraph: graph)
+        .generate();
+
+void main() {
+  group('dependency_graph', () {
+    test('Same output as a full rebuild', () {
+      final graph = DependencyGraph();
+      final bindings = _bindings();
+      expect(_generate(bindings, graph), _generate(_bindings()));
+      expect(graph.lastTraversalCount, 3);
+
+      // Nothing changed.
+      expect(_generate(bindings, graph), _generate(_bindings()));
+      expect(graph.lastTraversalCount, 0);
+    });
+
+    test('Only changed bindings are traversed again', () {
+      final graph = DependencyGraph();
+      final bindings = _bindings();
+      _generate(bindings, graph);
+
+      final a = ((bindings.first as Func).functionType.parameters.first.type
+              as PointerType)
+          .child as Struct;
+      final b = a.members.first.type as Struct;
+      b.members.add(Member(
+          name: 'c', type: PointerType(Struct(usr: 'c:@S@C', name: 'C'))));
+      graph.markDirty(b.usr);
+
+      expect(_generate(bindings, graph), _generate(_bindings(withC: true)));
+      // B and the new struct C.
+      expect(graph.lastTraversalCount, 2);
+    });
+
+    test('Bindings replaced by new objects with the same USRs', () {
+      final graph = DependencyGraph();
+      _generate(_bindings(), graph);
+
+      // The memoized edges are resolved to the new objects.
+      expect(_generate(_bindings(withC: true), graph),
+          _generate(_bindings(withC: true)));
+      expect(graph.lastTraversalCount, 4);
+    });
+
+    test('Dependents of a removed binding are traversed again', () {
+      final graph = DependencyGraph();
+      final bindings = _bindings();
+      final f = bindings.first as Func;
+      final a = (f.functionType.parameters.first.type as PointerType).child
+          as Struct;
+      final b = a.members.first.type as Struct;
+      final fingerprints = {f.usr: '', a.usr: '', b.usr: ''};
+      graph.updateDeclarations({f.usr: f, a.usr: a, b.usr: b}, fingerprints);
+      _generate(bindings, graph);
+
+      // A depends on the removed B, f only on A.
+      graph.updateDeclarations({f.usr: f, a.usr: a}, fingerprints);
+      expect(_generate(bindings, graph), _generate(_bindings()));
+      expect(graph.lastTraversalCount, 2);
+    });
+
+    test('Generating again from the same bindings', () {
+      final bindings = _renderedNameBindings();
+      final fresh = _generate(_renderedNameBindings());
+      expect(fresh, contains('int a1'));
+      expect(fresh, contains('typedef DartG1 ='));
+
+      final library = Library(name: 'Bindings', bindings: bindings);
+      expect(library.generate(), fresh);
+      expect(library.generate(), fresh);
+      expect(_generate(bindings), fresh);
+
+      // The names resolved by the earlier builds don't leak into this one.
+      expect(_generate(_withoutConflicts(bindings)),
+          _generate(_withoutConflicts(_renderedNameBindings())));
+    });
+
+    test('Name conflicts are resolved as in a full rebuild', () {
+      final graph = DependencyGraph();
+      final first = Func(usr: 'c:@F@g', name: 'g', returnType: voidType);
+      final second = Func(usr: 'c:@F@g2', name: 'g', returnType: voidType);
+
+      final library = Library(
+          name: 'Bindings', bindings: [first, second], dependencyGraph: graph);
+      expect(library.bindings.map((b) => b.name), ['g', 'g1']);
+
+      // Without the first function, the second one keeps its declared name.
+      final rebuilt = Library(
+          name: 'Bindings', bindings: [second], dependencyGraph: graph);
+      expect(rebuilt.bindings.map((b) => b.name), ['g']);
+    });
+  });
+}
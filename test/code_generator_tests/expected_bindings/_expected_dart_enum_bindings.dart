@@ -0,0 +1,70 @@
+// ignore_for_file: unused_import
+
+// AUTO GENERATED FILE, DO NOT EDIT.
+//
+// Generated by `package:ffigen`.
+// ignore_for_file: type=lint
+/// Dense values.
+enum Status {
+  /// negative
+  error(-1),
+  ok(0),
+  retry(2),
+  value1(3);
+
+  /// Same as ok.
+  static const success = ok;
+
+  const Status(this.value);
+
+  /// The value of this constant in C.
+  final int value;
+
+  static const _byValue = <Status?>[
+    error,
+    ok,
+    null,
+    retry,
+    value1,
+  ];
+
+  /// Returns the constant with [value], throws an [ArgumentError] if there
+  /// is none.
+  static Status fromValue(int value) {
+    final index = value + 1;
+    final result =
+        index >= 0 && index < _byValue.length ? _byValue[index] : null;
+    if (result == null) {
+      throw ArgumentError.value(value, 'value', 'Unknown value for Status.');
+    }
+    return result;
+  }
+}
+
+/// Sparse values.
+enum Signal {
+  a(1),
+  b(100),
+  c(10000);
+
+  const Signal(this.value);
+
+  /// The value of this constant in C.
+  final int value;
+
+  static const _byValue = <int, Signal>{
+    1: a,
+    100: b,
+    10000: c,
+  };
+
+  /// Returns the constant with [value], throws an [ArgumentError] if there
+  /// is none.
+  static Signal fromValue(int value) {
+    final result = _byValue[value];
+    if (result == null) {
+      throw ArgumentError.value(value, 'value', 'Unknown value for Signal.');
+    }
+    return result;
+  }
+}
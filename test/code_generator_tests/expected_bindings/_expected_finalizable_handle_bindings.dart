@@ -0,0 +1,104 @@
+// AUTO GENERATED FILE, DO NOT EDIT.
+//
+// Generated by `package:ffigen`.
+// ignore_for_file: type=lint
+import 'dart:ffi' as ffi;
+
+class Bindings {
+  /// Holds the symbol lookup function.
+  final ffi.Pointer<T> Function<T extends ffi.NativeType>(String symbolName)
+      _lookup;
+
+  /// The symbols are looked up in [dynamicLibrary].
+  Bindings(ffi.DynamicLibrary dynamicLibrary) : _lookup = dynamicLibrary.lookup;
+
+  /// The symbols are looked up with [lookup].
+  Bindings.fromLookup(
+      ffi.Pointer<T> Function<T extends ffi.NativeType>(String symbolName)
+          lookup)
+      : _lookup = lookup;
+
+  void db_free(
+    ffi.Pointer<Db> db,
+  ) {
+    return _db_free(
+      db,
+    );
+  }
+
+  late final _db_freePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<Db>)>>(
+          'db_free');
+  late final _db_free =
+      _db_freePtr.asFunction<void Function(ffi.Pointer<Db>)>();
+
+  int db_size(
+    ffi.Pointer<Db> db,
+  ) {
+    return _db_size(
+      db,
+    );
+  }
+
+  late final _db_sizePtr =
+      _lookup<ffi.NativeFunction<ffi.Size Function(ffi.Pointer<Db>)>>(
+          'db_size');
+  late final _db_size = _db_sizePtr.asFunction<int Function(ffi.Pointer<Db>)>();
+}
+
+final class Db extends ffi.Opaque {}
+
+/// Owns a [Db], which is released with `db_free`.
+///
+/// The struct is released by [dispose], or by a native finalizer once this
+/// handle is garbage collected.
+final class DbHandle implements ffi.Finalizable {
+  static final _finalizers = Expando<ffi.NativeFinalizer>();
+  static final _releases = Expando<void Function(ffi.Pointer<ffi.Void>)>();
+
+  ffi.Pointer<Db> _pointer;
+  final ffi.NativeFinalizer _finalizer;
+  final void Function(ffi.Pointer<ffi.Void>) _release;
+
+  /// Native memory owned by the struct in bytes, as reported to the garbage
+  /// collector.
+  final int externalSize;
+
+  DbHandle._(this._pointer, this._finalizer, this._release, this.externalSize) {
+    _finalizer.attach(this, _pointer.cast(),
+        detach: this, externalSize: externalSize);
+  }
+
+  /// Takes ownership of [pointer], which must have been created by [lib].
+  factory DbHandle(Bindings lib, ffi.Pointer<Db> pointer) {
+    var finalizer = _finalizers[lib];
+    var release = _releases[lib];
+    if (finalizer == null || release == null) {
+      final destructor = lib._lookup<ffi.NativeFinalizerFunction>('db_free');
+      finalizer = ffi.NativeFinalizer(destructor);
+      release = destructor.asFunction<void Function(ffi.Pointer<ffi.Void>)>();
+      _finalizers[lib] = finalizer;
+      _releases[lib] = release;
+    }
+    return DbHandle._(pointer, finalizer, release, lib.db_size(pointer));
+  }
+
+  /// The owned pointer, throws a [StateError] once this has been disposed.
+  ffi.Pointer<Db> get pointer {
+    if (_pointer == ffi.nullptr) {
+      throw StateError('DbHandle has already been disposed.');
+    }
+    return _pointer;
+  }
+
+  bool get isDisposed => _pointer == ffi.nullptr;
+
+  /// Releases the struct now, instead of when this handle is garbage
+  /// collected. Does nothing if this has already been disposed.
+  void dispose() {
+    if (_pointer == ffi.nullptr) return;
+    _finalizer.detach(this);
+    _release(_pointer.cast());
+    _pointer = ffi.nullptr;
+  }
+}
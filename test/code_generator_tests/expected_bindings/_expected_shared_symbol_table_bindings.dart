@@ -0,0 +1,92 @@
+// AUTO GENERATED FILE, DO NOT EDIT.
+//
+// Generated by `package:ffigen`.
+// ignore_for_file: type=lint
+import 'dart:ffi' as ffi;
+import 'package:ffi/ffi.dart' as pkg_ffi;
+
+class Bindings {
+  /// Holds the symbol lookup function.
+  final ffi.Pointer<T> Function<T extends ffi.NativeType>(String symbolName)
+      _lookup;
+
+  /// The symbols are looked up in [dynamicLibrary].
+  Bindings(ffi.DynamicLibrary dynamicLibrary) : _lookup = dynamicLibrary.lookup;
+
+  /// The symbols are looked up with [lookup].
+  Bindings.fromLookup(
+      ffi.Pointer<T> Function<T extends ffi.NativeType>(String symbolName)
+          lookup)
+      : _lookup = lookup;
+
+  /// The symbols are read from [symbolTable], created by [createSymbolTable].
+  ///
+  /// No symbols are looked up, so this is cheap to call in every isolate that
+  /// uses the library.
+  Bindings.fromSymbolTable(ffi.Pointer<ffi.Pointer<ffi.Void>> symbolTable)
+      : _lookup = _SymbolTable(symbolTable).lookup;
+
+  /// Looks up all the symbols used by this class in [dynamicLibrary] once, and
+  /// stores their addresses in native memory allocated with [allocator].
+  ///
+  /// The table can be sent to other isolates, which create this class with
+  /// [Bindings.fromSymbolTable]. Symbols missing from [dynamicLibrary] throw
+  /// when they're first used.
+  static ffi.Pointer<ffi.Pointer<ffi.Void>> createSymbolTable(
+      ffi.DynamicLibrary dynamicLibrary,
+      {ffi.Allocator allocator = pkg_ffi.malloc}) {
+    final symbolTable =
+        allocator<ffi.Pointer<ffi.Void>>(_SymbolTable.symbolNames.length);
+    for (var i = 0; i < _SymbolTable.symbolNames.length; ++i) {
+      final symbolName = _SymbolTable.symbolNames[i];
+      symbolTable[i] = dynamicLibrary.providesSymbol(symbolName)
+          ? dynamicLibrary.lookup<ffi.Void>(symbolName)
+          : ffi.nullptr;
+    }
+    return symbolTable;
+  }
+
+  int add(
+    int a,
+  ) {
+    return _add(
+      a,
+    );
+  }
+
+  late final _addPtr =
+      _lookup<ffi.NativeFunction<ffi.Int32 Function(ffi.Int32)>>('add');
+  late final _add = _addPtr.asFunction<int Function(int)>();
+
+  late final ffi.Pointer<ffi.Int32> _counter = _lookup<ffi.Int32>('counter');
+
+  int get counter => _counter.value;
+
+  set counter(int value) => _counter.value = value;
+}
+
+/// Addresses of the symbols used by [Bindings], in native memory.
+class _SymbolTable {
+  static const symbolNames = <String>[
+    'add',
+    'counter',
+  ];
+
+  static const _indices = <String, int>{
+    'add': 0,
+    'counter': 1,
+  };
+
+  final ffi.Pointer<ffi.Pointer<ffi.Void>> symbolTable;
+
+  _SymbolTable(this.symbolTable);
+
+  ffi.Pointer<T> lookup<T extends ffi.NativeType>(String symbolName) {
+    final index = _indices[symbolName];
+    final address = index == null ? ffi.nullptr : symbolTable[index];
+    if (address == ffi.nullptr) {
+      throw ArgumentError("Failed to lookup symbol '$symbolName'");
+    }
+    return address.cast<T>();
+  }
+}
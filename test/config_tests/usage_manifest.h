@@ -0,0 +1,35 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+struct UsedStruct {
+  int a;
+};
+
+struct Dependency {
+  int b;
+};
+
+struct UnusedStruct {
+  int c;
+};
+
+typedef int Int;
+
+void usedFunc(struct Dependency *d, Int i);
+
+void renamedFunc();
+
+void unusedFunc(struct UnusedStruct *s);
+
+#define USED_MACRO 1
+#define UNUSED_MACRO 2
+
+enum UnusedEnum {
+  zero = 0,
+};
+
+enum {
+  usedConstant = 1,
+  unusedConstant = 2,
+};
@@ -0,0 +1,79 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:io';
+
+import 'package:ffigen/ffigen.dart';
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/strings.dart' as strings;
+import 'package:path/path.dart' as path;
+import 'package:test/test.dart';
+
+import '../test_utils.dart';
+
+void main() {
+  group('usage_manifest', () {
+    late Directory tempDir;
+    late Library library;
+
+    setUpAll(() {
+      tempDir = Directory.systemTemp.createTempSync('usage_manifest_test');
+      File(path.join(tempDir.path, 'app.dart')).writeAsStringSync('''
+void main() {
+  // Identifiers used by Dart code are part of the manifest.
+  print(usedConstant);
+}
+''');
+
+      final config = testConfig('''
+${strings.name}: 'NativeLibrary'
+${strings.description}: 'usage_manifest test'
+${strings.output}: 'unused'
+${strings.headers}:
+  ${strings.entryPoints}:
+    - 'test/config_tests/usage_manifest.h'
+${strings.functions}:
+  ${strings.rename}:
+    'renamedFunc': 'renamed_func'
+${strings.usageManifest}:
+  ${strings.usageManifestFiles}:
+    - 'test/config_tests/usage_manifest.txt'
+  ${strings.usageManifestDartSources}:
+    - '${path.join(tempDir.path, '*.dart')}'
+''');
+      library = parse(config);
+    });
+
+    tearDownAll(() {
+      tempDir.deleteSync(recursive: true);
+    });
+
+    test('Used declarations are generated', () {
+      expect(library.getBinding('UsedStruct'), isA<Struct>());
+      expect(library.getBinding('usedFunc'), isA<Func>());
+      expect(library.getBinding('USED_MACRO'), isA<Constant>());
+    });
+
+    test('Generated names are matched', () {
+      expect(library.getBinding('renamed_func'), isA<Func>());
+    });
+
+    test('Identifiers from Dart sources are matched', () {
+      expect(library.getBinding('usedConstant'), isA<Constant>());
+    });
+
+    test('Dependencies of used declarations are generated', () {
+      expect(library.getBinding('Dependency'), isA<Struct>());
+      expect(library.getBinding('Int'), isA<Typealias>());
+    });
+
+    test('Unused declarations are removed', () {
+      expect(() => library.getBinding('UnusedStruct'), throwsException);
+      expect(() => library.getBinding('unusedFunc'), throwsException);
+      expect(() => library.getBinding('UNUSED_MACRO'), throwsException);
+      expect(() => library.getBinding('UnusedEnum'), throwsException);
+      expect(() => library.getBinding('unusedConstant'), throwsException);
+    });
+  });
+}
@@ -0,0 +1,9 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// ARRAY_LENGTH is defined by the compile command of this header.
+struct Struct2
+{
+    int values[ARRAY_LENGTH];
+};
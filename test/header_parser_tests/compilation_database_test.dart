@@ -0,0 +1,110 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/header_parser.dart' as parser;
+import 'package:ffigen/src/header_parser/compilation_database.dart';
+import 'package:ffigen/src/strings.dart' as strings;
+import 'package:logging/logging.dart';
+import 'package:path/path.dart' as path;
+import 'package:test/test.dart';
+
+import '../test_utils.dart';
+
+late Library actual;
+late Directory buildDir;
+late List<String> headers;
+void main() {
+  group('compilation_database_test', () {
+    setUpAll(() {
+      logWarnings(Level.SEVERE);
+      headers = [
+        for (var i = 1; i <= 3; i++)
+          File('test/header_parser_tests/compilation_database_$i.h')
+              .absolute
+              .path
+      ];
+
+      // The first two headers share their flags.
+      buildDir = Directory.systemTemp.createTempSync('ffigen_cdb');
+      File(path.join(buildDir.path, 'compile_commands.json'))
+          .writeAsStringSync(jsonEncode([
+        for (var i = 0; i < 3; i++)
+          {
+            'directory': buildDir.path,
+            'file': headers[i],
+            'arguments': [
+              'clang',
+              '-DARRAY_LENGTH=${i < 2 ? 2 : 5}',
+              '-c',
+              headers[i],
+              '-o',
+              'out_$i.o',
+            ],
+          }
+      ]));
+
+      actual = parser.parse(
+        testConfig('''
+${strings.name}: 'NativeLibrary'
+${strings.description}: 'Compilation Database Test'
+${strings.output}: 'unused'
+${strings.headers}:
+  ${strings.entryPoints}:
+${headers.map((h) => "    - '$h'").join('\n')}
+${strings.compilationDatabase}: '${buildDir.path}'
+        '''),
+      );
+    });
+
+    tearDownAll(() {
+      buildDir.deleteSync(recursive: true);
+    });
+
+    test('Headers with the same flags are grouped', () {
+      final groups = groupHeadersByCompileCommand(buildDir.path, headers);
+      expect(groups.map((g) => g.headers), [
+        [headers[0], headers[1]],
+        [headers[2]],
+      ]);
+      expect(groups[0].compilerOpts,
+          ['-working-directory=${buildDir.path}', '-DARRAY_LENGTH=2']);
+    });
+
+    test('Flags from the compilation database are used', () {
+      int arrayLength(String name) =>
+          ((actual.getBinding(name) as Struct).members.single.type
+                  as ConstantArray)
+              .length;
+      expect(arrayLength('Struct1'), 2);
+      expect(arrayLength('Struct2'), 2);
+      expect(arrayLength('Struct3'), 5);
+    });
+
+    test('Macros are evaluated with the flags of their group', () {
+      expect((actual.getBinding('LENGTH_1') as Constant).rawValue, '2');
+      expect((actual.getBinding('LENGTH_3') as Constant).rawValue, '5');
+    });
+
+    test('Compile command to compiler opts', () {
+      expect(
+          compileCommandToCompilerOpts('/build', '/src/a.c', [
+            '-I',
+            'include',
+            '-MD',
+            '-MF',
+            'a.d',
+            '-o',
+            'a.o',
+            '-oa.o',
+            '-c',
+            '../src/a.c',
+          ]),
+          ['-working-directory=/build', '-I', 'include']);
+    });
+  });
+}
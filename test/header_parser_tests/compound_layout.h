@@ -0,0 +1,32 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include <stdint.h>
+
+struct Point
+{
+    int8_t tag;
+    int64_t x;
+    int32_t *y;
+    int16_t values[3];
+};
+
+#pragma pack(push, 2)
+struct Pack2
+{
+    int8_t a;
+    int64_t b;
+};
+#pragma pack(pop)
+
+union Number
+{
+    int32_t i;
+    double d;
+};
+
+struct Incomplete;
+
+void func(struct Point *p, struct Pack2 *q, union Number *n,
+          struct Incomplete *i);
@@ -0,0 +1,86 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/header_parser.dart' as parser;
+import 'package:ffigen/src/strings.dart' as strings;
+import 'package:logging/logging.dart';
+import 'package:test/test.dart';
+
+import '../test_utils.dart';
+
+late Library actual;
+late String pointBinding;
+void main() {
+  group('compound_layout_test', () {
+    setUpAll(() {
+      logWarnings(Level.SEVERE);
+      actual = parser.parse(
+        testConfig('''
+${strings.name}: 'NativeLibrary'
+${strings.description}: 'Compound Layout Test'
+${strings.output}: 'unused'
+${strings.headers}:
+  ${strings.entryPoints}:
+    - 'test/header_parser_tests/compound_layout.h'
+${strings.compoundLayout}:
+  ${strings.compoundLayoutVerify}: true
+  ${strings.compoundLayoutOffsetAccessors}:
+    ${strings.include}:
+      - 'Point'
+        '''),
+      );
+      pointBinding = actual.getBindingAsString('Point');
+    });
+
+    test('Layout recorded from clang', () {
+      final point = actual.getBinding('Point') as Struct;
+      expect(point.size, 32);
+      expect(point.alignment, 8);
+      expect(point.members.map((m) => m.offsetInBits),
+          [0, 8 * 8, 16 * 8, 24 * 8]);
+
+      final pack2 = actual.getBinding('Pack2') as Struct;
+      expect(pack2.size, 10);
+      expect(pack2.members.map((m) => m.offsetInBits), [0, 2 * 8]);
+
+      final number = actual.getBinding('Number') as Union;
+      expect(number.size, 8);
+      expect(number.members.map((m) => m.offsetInBits), [0, 0]);
+    });
+
+    test('Incomplete compound has no layout', () {
+      final incomplete = actual.getBinding('Incomplete') as Struct;
+      expect(incomplete.size, isNull);
+      expect(incomplete.hasLayoutTable, isFalse);
+    });
+
+    test('Layout table', () {
+      expect(pointBinding, contains('static const int sizeOf = 32;'));
+      expect(pointBinding, contains('static const int alignOf = 8;'));
+      expect(pointBinding, contains("'x': 8,"));
+      expect(pointBinding, contains("'values': 24,"));
+    });
+
+    test('Offset accessors', () {
+      expect(pointBinding,
+          contains('extension PointFields on ffi.Pointer<Point>'));
+      expect(
+          pointBinding,
+          contains('int get x => '
+              'ffi.Pointer<ffi.Int64>.fromAddress(this.address + 8).value;'));
+      expect(pointBinding, isNot(contains('get values')));
+
+      // Only enabled for the included compounds.
+      expect(actual.getBindingAsString('Pack2'), isNot(contains('extension')));
+    });
+
+    test('Layout verifier', () {
+      final generated = actual.generate();
+      expect(generated, contains('bool verifyCompoundLayouts()'));
+      expect(generated, contains('if (ffi.sizeOf<Pack2>() != Pack2.sizeOf)'));
+      expect(generated, isNot(contains('Incomplete.sizeOf')));
+    });
+  });
+}
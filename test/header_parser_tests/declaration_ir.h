@@ -0,0 +1,62 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define VERSION 3
+#define GREETING "hello"
+
+typedef struct Node Node;
+
+/// A node of a linked list.
+struct Node
+{
+    int32_t value;
+    Node *next;
+};
+
+union Number
+{
+    int64_t i;
+    double d;
+};
+
+enum Color
+{
+    red,
+    green = 5,
+};
+
+enum
+{
+    unnamed_constant = 10,
+};
+
+struct Flags
+{
+    uint32_t enabled : 1;
+    int32_t level : 7;
+    uint8_t bytes[4];
+};
+
+#pragma pack(push, 1)
+struct Packed
+{
+    char c;
+    int64_t i;
+};
+#pragma pack(pop)
+
+typedef int (*Callback)(Node *node, void *data);
+
+extern size_t node_count;
+
+/// Visits all nodes.
+bool visit(Node *list, Callback callback, void *data);
+
+union Number add(union Number a, union Number b, enum Color color);
+
+void flags_init(struct Flags *flags, struct Packed packed, const char *name);
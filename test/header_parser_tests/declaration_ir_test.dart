@@ -0,0 +1,139 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/config_provider.dart';
+import 'package:ffigen/src/declaration_ir.dart';
+import 'package:ffigen/src/header_parser.dart' as parser;
+import 'package:ffigen/src/strings.dart' as strings;
+import 'package:logging/logging.dart';
+import 'package:path/path.dart' as path;
+import 'package:test/test.dart';
+
+import '../test_utils.dart';
+
+late Config config;
+late Library actual;
+late Directory tempDir;
+late File irFile;
+void main() {
+  group('declaration_ir_test', () {
+    setUpAll(() {
+      logWarnings(Level.SEVERE);
+      tempDir = Directory.systemTemp.createTempSync('ffigen_ir');
+      irFile = File(path.join(tempDir.path, 'declarations.json'));
+      config = testConfig('''
+${strings.name}: 'NativeLibrary'
+${strings.description}: 'Declaration IR Test'
+${strings.output}:
+  ${strings.bindings}: 'unused'
+  ${strings.ir}: '${irFile.path}'
+${strings.headers}:
+  ${strings.entryPoints}:
+    - 'test/header_parser_tests/declaration_ir.h'
+${strings.compoundLayout}:
+  ${strings.compoundLayoutTables}: true
+${strings.functions}:
+  ${strings.symbolAddress}:
+    ${strings.include}:
+      - visit
+  ${strings.exposeFunctionTypedefs}:
+    ${strings.include}:
+      - add
+''');
+      actual = parser.parse(config);
+    });
+
+    tearDownAll(() {
+      tempDir.deleteSync(recursive: true);
+    });
+
+    test('IR file is written with the current format version', () {
+      final ir = jsonDecode(irFile.readAsStringSync()) as Map<String, dynamic>;
+      expect(ir[strings.formatVersion], strings.irFormatVersion);
+    });
+
+    test('Generated code from the IR is identical', () {
+      expect(parser.parseIr(config, irFile).generate(), actual.generate());
+    });
+
+    test('Code generation options are applied when reading the IR', () {
+      // The IR was written without these options.
+      final nativeConfig = testConfig('''
+${strings.name}: 'NativeLibrary'
+${strings.description}: 'Declaration IR Test'
+${strings.output}: 'unused'
+${strings.headers}:
+  ${strings.entryPoints}:
+    - 'test/header_parser_tests/declaration_ir.h'
+${strings.ffiNative}:
+${strings.functions}:
+  ${strings.leafFunctions}:
+    ${strings.include}:
+      - add
+${strings.enums}:
+  ${strings.enumsAsDartEnums}:
+    ${strings.include}:
+      - Color
+''');
+      final fromIr = parser.parseIr(nativeConfig, irFile);
+      expect(fromIr.generate(), parser.parse(nativeConfig).generate());
+      expect(fromIr.generate(), contains('@ffi.Native<'));
+    });
+
+    test('Regenerating from the IR with a dependency graph', () {
+      final graph = DependencyGraph();
+      final expected = parser.parseIr(config, irFile).generate();
+      expect(parser.parseIr(config, irFile, dependencyGraph: graph).generate(),
+          expected);
+      final fullCount = graph.lastTraversalCount;
+
+      // Nothing changed, only the typedef exposed for `add` is a new binding.
+      expect(parser.parseIr(config, irFile, dependencyGraph: graph).generate(),
+          expected);
+      expect(graph.lastTraversalCount, lessThan(fullCount));
+
+      // Rename a struct in a copy of the IR.
+      final ir = jsonDecode(irFile.readAsStringSync()) as Map<String, dynamic>;
+      (ir[strings.irDeclarations] as List)
+          .cast<Map<String, dynamic>>()
+          .firstWhere((d) => d['kind'] == 'struct' && d['name'] == 'Node')
+          .update('name', (_) => 'ListNode');
+      final renamedFile = File(path.join(tempDir.path, 'renamed.json'))
+        ..writeAsStringSync(jsonEncode(ir));
+      final renamed =
+          parser.parseIr(config, renamedFile, dependencyGraph: graph);
+      expect(renamed.generate(),
+          parser.parseIr(config, renamedFile).generate());
+      expect(renamed.generate(), contains('class ListNode'));
+    });
+
+    test('IR contains USRs, comments and source locations', () {
+      final ir = jsonDecode(irFile.readAsStringSync()) as Map<String, dynamic>;
+      final node = (ir[strings.irDeclarations] as List)
+          .cast<Map<String, dynamic>>()
+          .firstWhere((d) => d['kind'] == 'struct' && d['name'] == 'Node');
+      expect(node['usr'], 'c:@S@Node');
+      expect(node['dartDoc'], 'A node of a linked list.');
+
+      final location = locationsFromIr(ir)['c:@S@Node']!;
+      expect(path.basename(location.file), 'declaration_ir.h');
+      expect(location.line, 15);
+      expect(location.column, 8);
+    });
+
+    test('Recursive types are read back as the same declaration', () {
+      final bindings = bindingsFromIr(
+          jsonDecode(irFile.readAsStringSync()) as Map<String, dynamic>,
+          config);
+      final node =
+          bindings.whereType<Struct>().firstWhere((s) => s.name == 'Node');
+      final next = node.members[1].type as PointerType;
+      expect(next.child.typealiasType, same(node));
+    });
+  });
+}
@@ -0,0 +1,19 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include <stddef.h>
+
+typedef struct Db Db;
+struct Stream;
+struct File;
+
+Db *db_open(const char *path);
+void db_close(Db *db);
+size_t db_memory_used(const Db *db);
+
+struct Stream *stream_open(void);
+void stream_close(struct Stream *stream);
+
+struct File *file_open(const char *path);
+int file_close(struct File *file);
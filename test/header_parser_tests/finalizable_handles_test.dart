@@ -0,0 +1,62 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/header_parser.dart' as parser;
+import 'package:ffigen/src/strings.dart' as strings;
+import 'package:logging/logging.dart';
+import 'package:test/test.dart';
+
+import '../test_utils.dart';
+
+late Library actual;
+void main() {
+  group('finalizable_handles_test', () {
+    setUpAll(() {
+      logWarnings(Level.SEVERE);
+      actual = parser.parse(
+        testConfig('''
+${strings.name}: 'NativeLibrary'
+${strings.description}: 'Finalizable Handles Test'
+${strings.output}: 'unused'
+${strings.headers}:
+  ${strings.entryPoints}:
+    - 'test/header_parser_tests/finalizable_handles.h'
+${strings.finalizableHandles}:
+  Db:
+    ${strings.finalizableHandleDestructor}: db_close
+    ${strings.finalizableHandleSize}: db_memory_used
+  Stream:
+    ${strings.finalizableHandleDestructor}: stream_close
+  File:
+    ${strings.finalizableHandleDestructor}: file_close
+        '''),
+      );
+    });
+
+    test('Handle with a size function', () {
+      final handle = actual.getBinding('DbHandle') as FinalizableHandle;
+      expect(handle.compound.name, 'Db');
+      expect(handle.destructor.name, 'db_close');
+      expect(handle.size!.name, 'db_memory_used');
+
+      final s = actual.getBindingAsString('DbHandle');
+      expect(s, contains('lib._lookup<ffi.NativeFinalizerFunction>('));
+      expect(s, contains("'db_close'"));
+      expect(s, contains('lib.db_memory_used(pointer)'));
+    });
+
+    test('Handle without a size function', () {
+      final handle = actual.getBinding('StreamHandle') as FinalizableHandle;
+      expect(handle.size, isNull);
+      expect(actual.getBindingAsString('StreamHandle'),
+          contains('StreamHandle._(pointer, finalizer, release, 0)'));
+    });
+
+    test('Destructor with the wrong signature is skipped', () {
+      expect(
+          actual.bindings.map((b) => b.name), isNot(contains('FileHandle')));
+    });
+  });
+}
@@ -19,7 +19,7 @@ struct Struct3
     int b[]; // Flexible array member.
 };
 
-// All members should be removed, Bit fields are not supported.
+// Bit fields are generated as accessors on a Uint32 storage unit.
 struct Struct4
 {
     int a : 3;
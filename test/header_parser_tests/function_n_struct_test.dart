@@ -49,7 +49,12 @@ ${strings.headers}:
       expect((actual.getBinding('Struct3') as Struct).members.isEmpty, true);
     });
     test('Struct4 bit field member', () {
-      expect((actual.getBinding('Struct4') as Struct).members.isEmpty, true);
+      final members = (actual.getBinding('Struct4') as Struct).members;
+      expect(members.map((m) => m.name), ['_bitfield0', 'a']);
+      expect(members[0].type, NativeType(SupportedNativeType.Uint32));
+      expect(members[1].bitWidth, 3);
+      expect(members[1].isSignedBitField, true);
+      expect(members[1].bitFieldStorage, members[0]);
     });
     test('Struct5 incompleted struct member', () {
       expect((actual.getBinding('Struct5') as Struct).members.isEmpty, true);
@@ -0,0 +1,64 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'dart:ffi';
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/header_parser/clang_bindings/clang_bindings.dart';
+import 'package:ffigen/src/header_parser/parser.dart' as parser;
+import 'package:ffigen/src/strings.dart' as strings;
+import 'package:logging/logging.dart';
+import 'package:test/test.dart';
+
+import '../test_utils.dart';
+
+/// Counts the cursor kind spellings looked up, which are only needed for the
+/// debug strings of cursors.
+class _CountingClang extends Clang {
+  var kindSpellings = 0;
+
+  _CountingClang(super.dynamicLibrary);
+
+  @override
+  CXString clang_getCursorKindSpelling(int kind) {
+    kindSpellings++;
+    return super.clang_getCursorKindSpelling(kind);
+  }
+}
+
+void main() {
+  group('lazy_logging_test', () {
+    /// Parses and generates the bindings, and returns the number of debug
+    /// strings of cursors which were built.
+    int parseAndGenerate() {
+      final config = testConfig('''
+${strings.name}: 'NativeLibrary'
+${strings.description}: 'Lazy Logging Test'
+${strings.output}: 'unused'
+${strings.headers}:
+  ${strings.entryPoints}:
+    - 'test/header_parser_tests/function_n_struct.h'
+        ''');
+      final clang = _CountingClang(DynamicLibrary.open(config.libclangDylib));
+      parser.initParser(config, clang: clang);
+      Library(name: 'NativeLibrary', bindings: parser.parseToBindings())
+          .generate();
+      return clang.kindSpellings;
+    }
+
+    tearDown(() {
+      Logger.root.level = Level.INFO;
+    });
+
+    test('No debug strings are built at the default log level', () {
+      Logger.root.level = Level.INFO;
+      expect(parseAndGenerate(), 0);
+    });
+
+    test('Debug strings are built for verbose logs', () {
+      Logger.root.level = Level.ALL;
+      expect(parseAndGenerate(), greaterThan(0));
+    });
+  });
+}
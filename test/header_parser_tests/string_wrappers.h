@@ -0,0 +1,21 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#include <stddef.h>
+
+void log_message(int level, const char *message);
+
+int kv_put(const char *key, size_t key_len, const char *value, size_t len);
+
+const char *get_name(void *handle);
+
+char *dup_name(void *handle);
+
+int no_strings(int a);
+
+int read_line(char *buffer, size_t size);
+
+int copy_name(const char *name, char *out, size_t size);
+
+void not_included(const char *s);
@@ -0,0 +1,100 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+import 'package:ffigen/src/code_generator.dart';
+import 'package:ffigen/src/header_parser.dart' as parser;
+import 'package:ffigen/src/strings.dart' as strings;
+import 'package:logging/logging.dart';
+import 'package:test/test.dart';
+
+import '../test_utils.dart';
+
+late Library actual;
+late String generated;
+void main() {
+  group('string_wrappers_test', () {
+    setUpAll(() {
+      logWarnings(Level.SEVERE);
+      actual = parser.parse(
+        testConfig('''
+${strings.name}: 'NativeLibrary'
+${strings.description}: 'String Wrappers Test'
+${strings.output}: 'unused'
+${strings.headers}:
+  ${strings.entryPoints}:
+    - 'test/header_parser_tests/string_wrappers.h'
+${strings.functions}:
+  ${strings.stringWrappers}:
+    ${strings.include}:
+      - 'log_message'
+      - 'kv_put'
+      - 'get_name'
+      - 'dup_name'
+      - 'no_strings'
+      - 'read_line'
+      - 'copy_name'
+  ${strings.stringLengthArguments}:
+    ${strings.include}:
+      - 'kv_put'
+      - 'read_line'
+      - 'copy_name'
+        '''),
+      );
+      // Functions can only be rendered once, so all tests check the output of
+      // a single generate call.
+      generated = actual.generate();
+    });
+
+    test('String parameters', () {
+      expect(generated, contains('void log_message('));
+      expect(generated,
+          contains('void log_messageStr(int level, String message)'));
+      expect(generated,
+          contains('final messagePtr = _StringScratch.toNative(message)'));
+      expect(generated, contains('_StringScratch.release(mark);'));
+    });
+
+    test('Length arguments', () {
+      expect(generated, contains('int kv_putStr(String key, String value)'));
+      expect(generated,
+          contains('final keyLength = _StringScratch.lastLength;'));
+      expect(generated,
+          contains('kv_put(keyPtr, keyLength, valuePtr, valueLength)'));
+    });
+
+    test('String return', () {
+      expect(
+          generated,
+          contains('String? get_nameStr(ffi.Pointer<ffi.Void> handle, '
+              '{int? maxLength})'));
+      expect(generated, contains('_StringScratch.fromNative('));
+    });
+
+    test('Non const char pointers are passed through', () {
+      expect(generated, contains('int read_line('));
+      expect(generated, isNot(contains('read_lineStr')));
+      expect(
+          generated,
+          contains('int copy_nameStr(String name, '
+              'ffi.Pointer<ffi.Char> out, int size)'));
+      expect(generated, contains('copy_name(namePtr, out, size)'));
+    });
+
+    test('Non const char pointer returns are not decoded', () {
+      expect(generated, contains('ffi.Pointer<ffi.Char> dup_name('));
+      expect(generated, isNot(contains('dup_nameStr')));
+    });
+
+    test('Not generated without strings or when excluded', () {
+      expect(generated, contains('int no_strings('));
+      expect(generated, isNot(contains('no_stringsStr')));
+      expect(generated, contains('void not_included('));
+      expect(generated, isNot(contains('not_includedStr')));
+    });
+
+    test('Scratch arena is generated once', () {
+      expect('class _StringScratch'.allMatches(generated).length, 1);
+    });
+  });
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Objective C support is only available on mac.
+@TestOn('mac-os')
+
+import 'dart:ffi';
+import 'dart:io';
+
+import 'package:ffi/ffi.dart';
+import 'package:test/test.dart';
+import '../test_utils.dart';
+import 'borrowed_views_bindings.dart';
+import 'util.dart';
+
+void main() {
+  late BorrowedViewsTestObjCLibrary lib;
+  late Pointer<Int32> counter;
+
+  group('borrowed views', () {
+    setUpAll(() {
+      logWarnings();
+      final dylib = File('test/native_objc_test/borrowed_views_test.dylib');
+      verifySetupFile(dylib);
+      lib = BorrowedViewsTestObjCLibrary(
+          DynamicLibrary.open(dylib.absolute.path));
+      generateBindingsForCoverage('borrowed_views');
+    });
+
+    setUp(() {
+      counter = calloc<Int32>();
+    });
+
+    tearDown(() {
+      calloc.free(counter);
+    });
+
+    test('Unowned returns are not retained inside a scope', () {
+      final obj = BorrowTester.newWithCounter_(lib, counter);
+      expect(obj.refCount, 1);
+      lib.autoreleaseScope(() {
+        final view = obj.unownedReference();
+        expect(view, obj);
+        expect(obj.refCount, 1);
+        expect(() => view.release(), throwsStateError);
+      });
+      expect(obj.refCount, 1);
+
+      final owned = obj.unownedReference();
+      expect(obj.refCount, 2);
+      owned.release();
+      obj.release();
+      expect(counter.value, 0);
+    });
+
+    test('Owned returns are released when the scope ends', () {
+      final obj = BorrowTester.newWithCounter_(lib, counter);
+      final result = lib.autoreleaseScope(() {
+        for (var i = 0; i < 100; i++) {
+          obj.copyMe();
+          obj.autoreleasedCopy();
+        }
+        expect(counter.value, 201);
+        return 'done';
+      });
+      expect(result, 'done');
+      expect(counter.value, 1);
+      obj.release();
+      expect(counter.value, 0);
+    });
+
+    test('Casts inside a scope are owned', () {
+      final obj = BorrowTester.newWithCounter_(lib, counter);
+      final kept = lib.autoreleaseScope(
+          () => BorrowTester.castFrom(obj.copyMe()));
+      expect(counter.value, 2);
+      expect(kept.refCount, 1);
+      kept.release();
+      obj.release();
+      expect(counter.value, 0);
+    });
+
+    test('Scopes nest', () {
+      final obj = BorrowTester.newWithCounter_(lib, counter);
+      lib.autoreleaseScope(() {
+        obj.copyMe();
+        lib.autoreleaseScope(() {
+          obj.copyMe();
+          expect(counter.value, 3);
+        });
+        expect(counter.value, 2);
+      });
+      expect(counter.value, 1);
+      obj.release();
+    });
+  });
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#import <Foundation/NSObject.h>
+
+@interface BorrowTester : NSObject {
+  int32_t* counter;
+}
+
+@property(readonly) uint64_t refCount;
+
++ (instancetype)newWithCounter:(int32_t*) _counter;
+- (BorrowTester*)unownedReference;
+- (BorrowTester*)copyMe;
+- (BorrowTester*)autoreleasedCopy;
+
+@end
+
+@implementation BorrowTester
+
++ (instancetype)newWithCounter:(int32_t*) _counter {
+  BorrowTester* obj = [[BorrowTester alloc] init];
+  obj->_refCount = 1;
+  obj->counter = _counter;
+  ++*_counter;
+  return obj;
+}
+
+- (instancetype)retain {
+  ++self->_refCount;
+  return self;
+}
+
+- (oneway void)release {
+  --self->_refCount;
+  if (self->_refCount == 0) {
+    [self dealloc];
+  }
+}
+
+- (void)dealloc {
+  --*counter;
+  [super dealloc];
+}
+
+- (BorrowTester*)unownedReference {
+  return self;
+}
+
+- (BorrowTester*)copyMe {
+  return [BorrowTester newWithCounter: counter];
+}
+
+- (BorrowTester*)autoreleasedCopy {
+  return [[BorrowTester newWithCounter: counter] autorelease];
+}
+
+@end
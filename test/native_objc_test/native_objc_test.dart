@@ -62,5 +62,16 @@ void main() {
       expect(foo1.multiply_withOtherFoo_(false, foo2), 5);
       expect(foo1.multiply_withOtherFoo_(true, foo2), 200);
     });
+
+    test('Prefetching selectors and classes', () {
+      lib.prefetchObjCRuntime();
+      // Prefetching twice is a no-op.
+      lib.prefetchObjCRuntime();
+
+      final foo = Foo.makeFoo_(lib, 1.5);
+      expect(foo.intVal, 1);
+      expect(Foo.isInstance(foo), isTrue);
+      expect(Foo.isInstance(NSObject.new1(lib)), isFalse);
+    });
   });
 }
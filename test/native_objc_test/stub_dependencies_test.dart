@@ -0,0 +1,60 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Objective C support is only available on mac.
+@TestOn('mac-os')
+
+import 'dart:ffi';
+import 'dart:io';
+
+import 'package:test/test.dart';
+import '../test_utils.dart';
+import 'stub_dependencies_bindings.dart';
+import 'util.dart';
+
+void main() {
+  late StubDependenciesTestObjCLibrary lib;
+  late String bindings;
+
+  group('stub dependencies', () {
+    setUpAll(() {
+      logWarnings();
+      final dylib = File('test/native_objc_test/stub_dependencies_test.dylib');
+      verifySetupFile(dylib);
+      lib = StubDependenciesTestObjCLibrary(
+          DynamicLibrary.open(dylib.absolute.path));
+      bindings = File('test/native_objc_test/stub_dependencies_bindings.dart')
+          .readAsStringSync();
+      generateBindingsForCoverage('stub_dependencies');
+    });
+
+    test('Dependencies have no methods', () {
+      expect(bindings, contains('class Dependency extends NSObject'));
+      expect(bindings, contains('class StubChild extends StubParent'));
+      expect(bindings, isNot(contains('parentValue')));
+      expect(bindings, isNot(contains('childValue')));
+    });
+
+    test('Included interface is fully generated', () {
+      final tester = StubTester.new1(lib);
+      final dependency = tester.makeDependency();
+      expect(tester.valueOf_(dependency), 123);
+    });
+
+    test('Categories of promoted stubs are parsed', () {
+      final child = FullChild.new1(lib);
+      expect(child.baseValue(), 10);
+      expect(child.extraValue(), 20);
+      expect(child.fullChildValue(), 30);
+    });
+
+    test('Stubs can be cast', () {
+      final child = StubTester.new1(lib).makeChild();
+      expect(StubParent.isInstance(child), isTrue);
+      expect(Dependency.isInstance(child), isFalse);
+      final parent = StubParent.castFrom(child);
+      expect(StubChild.castFrom(parent), child);
+    });
+  });
+}
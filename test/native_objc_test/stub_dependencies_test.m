@@ -0,0 +1,126 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#import <Foundation/NSObject.h>
+
+@interface Dependency : NSObject {
+}
+
+- (int32_t) value;
+
+@end
+
+@interface StubParent : NSObject {
+}
+
+- (int32_t) parentValue;
+
+@end
+
+@interface StubChild : StubParent {
+}
+
+- (int32_t) childValue;
+
+@end
+
+@interface PromotedBase : NSObject {
+}
+
+- (int32_t) baseValue;
+
+@end
+
+@interface StubTester : NSObject {
+}
+
+- (Dependency *) makeDependency;
+- (PromotedBase *) makeBase;
+- (StubChild *) makeChild;
+- (int32_t) valueOf:(Dependency *) dependency;
+
+@end
+
+// PromotedBase is still a stub here, and is only promoted to a full interface
+// by FullChild below.
+@interface PromotedBase (Extras)
+
+- (int32_t) extraValue;
+
+@end
+
+@interface FullChild : PromotedBase {
+}
+
+- (int32_t) fullChildValue;
+
+@end
+
+@implementation Dependency
+
+- (int32_t) value {
+  return 123;
+}
+
+@end
+
+@implementation StubParent
+
+- (int32_t) parentValue {
+  return 456;
+}
+
+@end
+
+@implementation StubChild
+
+- (int32_t) childValue {
+  return 789;
+}
+
+@end
+
+@implementation PromotedBase
+
+- (int32_t) baseValue {
+  return 10;
+}
+
+@end
+
+@implementation PromotedBase (Extras)
+
+- (int32_t) extraValue {
+  return 20;
+}
+
+@end
+
+@implementation FullChild
+
+- (int32_t) fullChildValue {
+  return 30;
+}
+
+@end
+
+@implementation StubTester
+
+- (Dependency *) makeDependency {
+  return [Dependency new];
+}
+
+- (StubChild *) makeChild {
+  return [StubChild new];
+}
+
+- (PromotedBase *) makeBase {
+  return [PromotedBase new];
+}
+
+- (int32_t) valueOf:(Dependency *) dependency {
+  return [dependency value];
+}
+
+@end
@@ -0,0 +1,24 @@
+// AUTO GENERATED FILE, DO NOT EDIT.
+//
+// Generated by `package:ffigen`.
+// Batch shims, which call a function once for each element of their argument
+// arrays.
+
+#include <stddef.h>
+#include <stdint.h>
+
+int64_t Function1Int64(int64_t x);
+
+void ffigen_batch_Function1Int64(const int64_t *x, int64_t *result, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    result[i] = Function1Int64(x[i]);
+  }
+}
+
+double Function1Double(double x);
+
+void ffigen_batch_Function1Double(const double *x, double *result, size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    result[i] = Function1Double(x[i]);
+  }
+}
@@ -5,6 +5,8 @@
 // Generated by `package:ffigen`.
 // ignore_for_file: type=lint
 import 'dart:ffi' as ffi;
+import 'dart:typed_data' as typed_data;
+import 'package:ffi/ffi.dart' as pkg_ffi;
 
 /// Native tests.
 class NativeLibrary {
@@ -139,12 +141,54 @@ class NativeLibrary {
     );
   }
 
+  /// Calls [Function1Int64] once for each element of the lists.
+  ///
+  /// The lists must have the same length. They are copied to native memory, so
+  /// that all calls are made in a single FFI call.
+  typed_data.Int64List Function1Int64BatchList(typed_data.Int64List x) {
+    final count = x.length;
+    if (count == 0) return typed_data.Int64List(0);
+    final xPtr = pkg_ffi.malloc<ffi.Int64>(count);
+    final resultPtr = pkg_ffi.malloc<ffi.Int64>(count);
+    try {
+      xPtr.asTypedList(count).setAll(0, x);
+      Function1Int64Batch(xPtr, resultPtr, count);
+      return typed_data.Int64List.fromList(resultPtr.asTypedList(count));
+    } finally {
+      pkg_ffi.malloc.free(xPtr);
+      pkg_ffi.malloc.free(resultPtr);
+    }
+  }
+
   late final _Function1Int64Ptr =
       _lookup<ffi.NativeFunction<ffi.Int64 Function(ffi.Int64)>>(
           'Function1Int64');
   late final _Function1Int64 =
       _Function1Int64Ptr.asFunction<int Function(int)>();
 
+  /// Calls [Function1Int64] once for each element of the arrays.
+  ///
+  /// The arrays have [count] elements each, and all calls are made in a
+  /// single FFI call.
+  void Function1Int64Batch(
+    ffi.Pointer<ffi.Int64> x,
+    ffi.Pointer<ffi.Int64> result,
+    int count,
+  ) {
+    return _Function1Int64Batch(
+      x,
+      result,
+      count,
+    );
+  }
+
+  late final _Function1Int64BatchPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<ffi.Int64>, ffi.Pointer<ffi.Int64>,
+              ffi.Size)>>('ffigen_batch_Function1Int64');
+  late final _Function1Int64Batch = _Function1Int64BatchPtr.asFunction<
+      void Function(ffi.Pointer<ffi.Int64>, ffi.Pointer<ffi.Int64>, int)>();
+
   int Function1IntPtr(
     int x,
   ) {
@@ -195,12 +239,54 @@ class NativeLibrary {
     );
   }
 
+  /// Calls [Function1Double] once for each element of the lists.
+  ///
+  /// The lists must have the same length. They are copied to native memory, so
+  /// that all calls are made in a single FFI call.
+  typed_data.Float64List Function1DoubleBatchList(typed_data.Float64List x) {
+    final count = x.length;
+    if (count == 0) return typed_data.Float64List(0);
+    final xPtr = pkg_ffi.malloc<ffi.Double>(count);
+    final resultPtr = pkg_ffi.malloc<ffi.Double>(count);
+    try {
+      xPtr.asTypedList(count).setAll(0, x);
+      Function1DoubleBatch(xPtr, resultPtr, count);
+      return typed_data.Float64List.fromList(resultPtr.asTypedList(count));
+    } finally {
+      pkg_ffi.malloc.free(xPtr);
+      pkg_ffi.malloc.free(resultPtr);
+    }
+  }
+
   late final _Function1DoublePtr =
       _lookup<ffi.NativeFunction<ffi.Double Function(ffi.Double)>>(
           'Function1Double');
   late final _Function1Double =
       _Function1DoublePtr.asFunction<double Function(double)>();
 
+  /// Calls [Function1Double] once for each element of the arrays.
+  ///
+  /// The arrays have [count] elements each, and all calls are made in a
+  /// single FFI call.
+  void Function1DoubleBatch(
+    ffi.Pointer<ffi.Double> x,
+    ffi.Pointer<ffi.Double> result,
+    int count,
+  ) {
+    return _Function1DoubleBatch(
+      x,
+      result,
+      count,
+    );
+  }
+
+  late final _Function1DoubleBatchPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<ffi.Double>, ffi.Pointer<ffi.Double>,
+              ffi.Size)>>('ffigen_batch_Function1Double');
+  late final _Function1DoubleBatch = _Function1DoubleBatchPtr.asFunction<
+      void Function(ffi.Pointer<ffi.Double>, ffi.Pointer<ffi.Double>, int)>();
+
   ffi.Pointer<Struct1> getStruct1() {
     return _getStruct1();
   }
@@ -242,6 +328,34 @@ class NativeLibrary {
           'Function1StructPassByValue');
   late final _Function1StructPassByValue =
       _Function1StructPassByValuePtr.asFunction<int Function(Struct3)>();
+
+  BitFieldStruct BitFieldStructIncrement(
+    BitFieldStruct s,
+  ) {
+    return _BitFieldStructIncrement(
+      s,
+    );
+  }
+
+  late final _BitFieldStructIncrementPtr =
+      _lookup<ffi.NativeFunction<BitFieldStruct Function(BitFieldStruct)>>(
+          'BitFieldStructIncrement');
+  late final _BitFieldStructIncrement = _BitFieldStructIncrementPtr
+      .asFunction<BitFieldStruct Function(BitFieldStruct)>();
+
+  int PackedBitFieldStructSum(
+    PackedBitFieldStruct s,
+  ) {
+    return _PackedBitFieldStructSum(
+      s,
+    );
+  }
+
+  late final _PackedBitFieldStructSumPtr =
+      _lookup<ffi.NativeFunction<ffi.Int64 Function(PackedBitFieldStruct)>>(
+          'PackedBitFieldStructSum');
+  late final _PackedBitFieldStructSum = _PackedBitFieldStructSumPtr
+      .asFunction<int Function(PackedBitFieldStruct)>();
 }
 
 final class Struct1 extends ffi.Struct {
@@ -262,3 +376,64 @@ final class Struct3 extends ffi.Struct {
   @ffi.Int()
   external int c;
 }
+
+final class BitFieldStruct extends ffi.Struct {
+  @ffi.Uint32()
+  external int _bitfield0;
+
+  @ffi.Uint32()
+  external int _bitfield1;
+
+  int get flags => _bitfield0 & 0x7;
+
+  set flags(int value) => _bitfield0 = (_bitfield0 & ~0x7) | (value & 0x7);
+
+  int get level => ((_bitfield0 >> 3) & 0x1f).toSigned(5);
+
+  set level(int value) =>
+      _bitfield0 = (_bitfield0 & ~0xf8) | ((value & 0x1f) << 3);
+
+  int get wide => (_bitfield1 & 0x3fffffff).toSigned(30);
+
+  set wide(int value) =>
+      _bitfield1 = (_bitfield1 & ~0x3fffffff) | (value & 0x3fffffff);
+
+  int get enabled => (_bitfield1 >> 30) & 0x1;
+
+  set enabled(int value) =>
+      _bitfield1 = (_bitfield1 & ~0x40000000) | ((value & 0x1) << 30);
+
+  @ffi.Uint16()
+  external int after;
+}
+
+@ffi.Packed(1)
+final class PackedBitFieldStruct extends ffi.Struct {
+  @ffi.Uint8()
+  external int tag;
+
+  @ffi.Uint32()
+  external int _bitfield0;
+
+  int get low => _bitfield0 & 0xf;
+
+  set low(int value) => _bitfield0 = (_bitfield0 & ~0xf) | (value & 0xf);
+
+  int get high => (_bitfield0 >> 4) & 0xfff;
+
+  set high(int value) =>
+      _bitfield0 = (_bitfield0 & ~0xfff0) | ((value & 0xfff) << 4);
+
+  int get small => (_bitfield0 >> 16) & 0x7f;
+
+  set small(int value) =>
+      _bitfield0 = (_bitfield0 & ~0x7f0000) | ((value & 0x7f) << 16);
+
+  int get signedValue => ((_bitfield0 >> 23) & 0x1ff).toSigned(9);
+
+  set signedValue(int value) =>
+      _bitfield0 = (_bitfield0 & ~0xff800000) | ((value & 0x1ff) << 23);
+
+  @ffi.Uint8()
+  external int tail;
+}
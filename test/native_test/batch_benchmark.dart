@@ -0,0 +1,63 @@
+// Copyright (c) 2023, the Dart project authors. Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Compares calling a function once per element against its batch wrapper.
+//
+// Build the test library with `dart run test/native_test/build_test_dylib.dart`
+// from test/native_test, then run from the package root:
+//   dart run test/native_test/batch_benchmark.dart
+
+import 'dart:ffi';
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:ffi/ffi.dart';
+
+import '_expected_native_test_bindings.dart';
+
+const count = 1000000;
+const repetitions = 5;
+
+void main() {
+  var dylibName = 'test/native_test/native_test.so';
+  if (Platform.isMacOS) {
+    dylibName = 'test/native_test/native_test.dylib';
+  } else if (Platform.isWindows) {
+    dylibName = r'test\native_test\native_test.dll';
+  }
+  final bindings =
+      NativeLibrary(DynamicLibrary.open(File(dylibName).absolute.path));
+
+  final input = Float64List.fromList([for (var i = 0; i < count; i++) i / 2]);
+  final output = Float64List(count);
+  final inputPtr = malloc<Double>(count);
+  final outputPtr = malloc<Double>(count);
+  inputPtr.asTypedList(count).setAll(0, input);
+
+  for (var r = 0; r < repetitions; r++) {
+    final single = _time(() {
+      for (var i = 0; i < count; i++) {
+        output[i] = bindings.Function1Double(input[i]);
+      }
+    });
+    final batchList = _time(() => bindings.Function1DoubleBatchList(input));
+    final batch = _time(
+        () => bindings.Function1DoubleBatch(inputPtr, outputPtr, count));
+    print('$count calls: single ${single}us, '
+        'batch list ${batchList}us (${_speedup(single, batchList)}), '
+        'batch ${batch}us (${_speedup(single, batch)})');
+  }
+
+  malloc.free(inputPtr);
+  malloc.free(outputPtr);
+}
+
+int _time(void Function() f) {
+  final stopwatch = Stopwatch()..start();
+  f();
+  return stopwatch.elapsedMicroseconds;
+}
+
+String _speedup(int before, int after) =>
+    '${(before / after).toStringAsFixed(1)}x';
@@ -72,3 +72,42 @@ int Function1StructPassByValue(struct Struct3 sum_a_b_c)
 {
     return sum_a_b_c.a + sum_a_b_c.b + sum_a_b_c.c;
 }
+
+struct BitFieldStruct
+{
+    uint32_t flags : 3;
+    int32_t level : 5;
+    int32_t wide : 30; // Doesn't fit in the first storage unit.
+    uint32_t enabled : 1;
+    uint16_t after;
+};
+
+#pragma pack(push, 1)
+struct PackedBitFieldStruct
+{
+    uint8_t tag;
+    uint32_t low : 4;
+    uint32_t high : 12;
+    uint32_t small : 7;
+    int32_t signedValue : 9;
+    uint8_t tail;
+};
+#pragma pack(pop)
+
+struct BitFieldStruct BitFieldStructIncrement(struct BitFieldStruct s)
+{
+    s.flags += 1;
+    s.level += 1;
+    s.wide += 1;
+    s.enabled = !s.enabled;
+    s.after += 1;
+    return s;
+}
+
+int64_t PackedBitFieldStructSum(struct PackedBitFieldStruct s)
+{
+    return s.tag + s.low + s.high + s.small + s.signedValue + s.tail;
+}
+
+// The batch shims generated by ffigen are compiled into the same library.
+#include "_expected_native_test_batch.c"
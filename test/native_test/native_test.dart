@@ -5,7 +5,9 @@
 import 'dart:ffi';
 import 'dart:io';
 import 'dart:math';
+import 'dart:typed_data';
 
+import 'package:ffi/ffi.dart';
 import 'package:ffigen/ffigen.dart';
 import 'package:path/path.dart' as path;
 import 'package:test/test.dart';
@@ -57,6 +59,11 @@ void main() {
         print('Failed test: Debug generated file: ${outFile.absolute.path}');
         rethrow;
       }
+
+      final expectedBatchSource = File(config.batchCSource!)
+          .readAsStringSync()
+          .replaceAll('\r', '');
+      expect(library.generateBatchCSource(), expectedBatchSource);
     });
 
     test('bool', () {
@@ -100,6 +107,14 @@ void main() {
     test('double', () {
       expect(bindings.Function1Double(0), 42.0);
     });
+    test('Batch wrappers', () {
+      final x = Int64List.fromList([0, 1, -42, pow(2, 62).toInt()]);
+      expect(bindings.Function1Int64BatchList(x),
+          [42, 43, 0, pow(2, 62).toInt() + 42]);
+      expect(bindings.Function1DoubleBatchList(Float64List.fromList([0, 0.5])),
+          [42.0, 42.5]);
+      expect(bindings.Function1Int64BatchList(Int64List(0)), isEmpty);
+    });
     test('Array Test: Order of access', () {
       final struct1 = bindings.getStruct1();
       var expectedValue = 1;
@@ -152,5 +167,45 @@ void main() {
       final s = bindings.Function1StructReturnByValue(a, b, c);
       expect(bindings.Function1StructPassByValue(s), a + b + c);
     });
+    test('Bit fields', () {
+      final p = calloc<BitFieldStruct>();
+      p.ref
+        ..flags = 7
+        ..level = -16
+        ..wide = -1
+        ..enabled = 0
+        ..after = 1000;
+      final s = bindings.BitFieldStructIncrement(p.ref);
+      calloc.free(p);
+
+      expect(s.flags, 0); // Wraps around.
+      expect(s.level, -15);
+      expect(s.wide, 0);
+      expect(s.enabled, 1);
+      expect(s.after, 1001);
+
+      // Setting a field doesn't touch its neighbours.
+      s.wide = 0x1fffffff;
+      expect(s.flags, 0);
+      expect(s.level, -15);
+      expect(s.enabled, 1);
+      expect(s.wide, 0x1fffffff);
+    });
+    test('Packed bit fields', () {
+      final p = calloc<PackedBitFieldStruct>();
+      p.ref
+        ..tag = 1
+        ..low = 2
+        ..high = 0xfff
+        ..small = 4
+        ..signedValue = -256
+        ..tail = 5;
+      expect(sizeOf<PackedBitFieldStruct>(), 6);
+      expect(p.ref.high, 0xfff);
+      expect(p.ref.signedValue, -256);
+      expect(bindings.PackedBitFieldStructSum(p.ref),
+          1 + 2 + 0xfff + 4 - 256 + 5);
+      calloc.free(p);
+    });
   });
 }